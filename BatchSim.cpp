@@ -0,0 +1,157 @@
+// Runs many independent, headless game simulations in parallel for automated
+// playtesting / level validation, and prints an aggregate report.
+//
+// usage: batch [runs] [threads] [max_ticks]
+//   runs      - number of simulations (default 10000)
+//   threads   - worker threads; 0 means one per core (default 0)
+//   max_ticks - give up on a run after this many 60Hz ticks (default 36000, i.e. ten minutes)
+
+#include "Simulation.hpp"
+#include "ThreadPool.hpp"
+#include "data_path.hpp"
+#include "MappedChunks.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+//what happened in a single run:
+struct RunResult {
+	bool completed = false;
+	uint32_t ticks = 0;
+	uint32_t explosions = 0;
+	uint32_t room_reached = 0;
+};
+
+//A simple seeded bot: walks to (usually) the nearest un-reached object,
+// and heads for the door once it opens. It doesn't know which chests hold bombs.
+static RunResult play(std::shared_ptr< RoomList const > const &rooms, uint32_t seed, uint32_t max_ticks) {
+	constexpr float Tick = 1.0f / 60.0f;
+
+	std::mt19937 mt(seed);
+	Simulation sim(rooms);
+
+	glm::vec2 target = glm::vec2(0.0f);
+	bool have_target = false;
+	uint32_t target_room = -1U;
+
+	while (sim.ticks < max_ticks && !sim.finished()) {
+		//choose a new target when the old one is reached, or on entering a room:
+		if (!have_target || target_room != sim.rooms_entered || glm::distance(target, sim.player_at) < 0.5f) {
+			have_target = false;
+			target_room = sim.rooms_entered;
+			if (sim.door_open()) {
+				target = glm::vec2(Simulation::DoorX, Simulation::DoorY);
+				have_target = true;
+			} else {
+				//gather un-reached objects:
+				std::vector< glm::vec2 > options;
+				sim.room.for_each_archetype([&](auto const &archetype){
+					for (auto const &entry : archetype.entries) {
+						if (!entry.reached) options.emplace_back(glm::vec2(entry.at));
+					}
+				});
+				if (!options.empty()) {
+					//mostly go to the nearest one, sometimes pick at random:
+					if (mt() % 4 == 0) {
+						target = options[mt() % options.size()];
+					} else {
+						target = *std::min_element(options.begin(), options.end(), [&](glm::vec2 const &a, glm::vec2 const &b){
+							return glm::distance(a, sim.player_at) < glm::distance(b, sim.player_at);
+						});
+					}
+					have_target = true;
+				}
+			}
+		}
+
+		//line up horizontally first, then approach vertically:
+		// (collisions only count when the horizontal overlap is larger)
+		Simulation::Controls controls;
+		if (have_target) {
+			glm::vec2 delta = target - sim.player_at;
+			if (std::abs(delta.x) > 0.5f) {
+				controls.left = (delta.x < 0.0f);
+				controls.right = (delta.x > 0.0f);
+			} else {
+				controls.down = (delta.y < 0.0f);
+				controls.up = (delta.y > 0.0f);
+			}
+		}
+		sim.update(controls, Tick);
+	}
+
+	RunResult result;
+	result.completed = sim.finished();
+	result.ticks = sim.ticks;
+	result.explosions = sim.explosions;
+	result.room_reached = sim.room_num;
+	return result;
+}
+
+int main(int argc, char **argv) {
+	uint32_t runs = 10000;
+	uint32_t threads = 0;
+	uint32_t max_ticks = 60 * 60 * 10;
+	if (argc > 1) runs = uint32_t(std::stoul(argv[1]));
+	if (argc > 2) threads = uint32_t(std::stoul(argv[2]));
+	if (argc > 3) max_ticks = uint32_t(std::stoul(argv[3]));
+
+	//rooms come from the same tiles.bin the game loads:
+	// (only the room chunk is read, and every room is decoded before the clock starts)
+	auto rooms = read_rooms(std::make_shared< MappedChunks >(data_path("../tiles.bin")));
+	if (rooms->empty()) throw std::runtime_error("No rooms in tiles.bin");
+	for (size_t i = 0; i < rooms->size(); i++) {
+		(*rooms)[i];
+	}
+
+	ThreadPool pool(threads);
+	std::vector< RunResult > results(runs);
+
+	auto before = std::chrono::high_resolution_clock::now();
+	//small chunks so that slow runs (timeouts) get stolen around rather than stalling one worker:
+	pool.parallel_for(runs, [&](size_t i){
+		results[i] = play(rooms, uint32_t(i), max_ticks);
+	}, 16);
+	auto after = std::chrono::high_resolution_clock::now();
+	double seconds = std::chrono::duration< double >(after - before).count();
+
+	//aggregate (in run order, so the report doesn't depend on scheduling):
+	uint32_t completed = 0;
+	uint64_t completed_ticks = 0;
+	uint32_t min_ticks = -1U, max_completed_ticks = 0;
+	uint64_t explosions = 0;
+	std::vector< uint32_t > stuck_in_room(rooms->size(), 0);
+	for (auto const &result : results) {
+		explosions += result.explosions;
+		if (result.completed) {
+			completed += 1;
+			completed_ticks += result.ticks;
+			min_ticks = std::min(min_ticks, result.ticks);
+			max_completed_ticks = std::max(max_completed_ticks, result.ticks);
+		} else {
+			stuck_in_room[result.room_reached] += 1;
+		}
+	}
+
+	std::cout << "Ran " << runs << " simulations on " << pool.size() << " threads in " << seconds << "s ("
+	          << (seconds > 0.0 ? runs / seconds : 0.0) << " runs/s).\n";
+	std::cout << "  completed: " << completed << " (" << (runs ? 100.0 * completed / runs : 0.0) << "%)\n";
+	if (completed) {
+		std::cout << "  ticks to complete: min " << min_ticks
+		          << ", mean " << double(completed_ticks) / completed
+		          << ", max " << max_completed_ticks << "\n";
+	}
+	std::cout << "  explosions: " << explosions << " (" << (runs ? double(explosions) / runs : 0.0) << " per run)\n";
+	for (uint32_t i = 0; i < stuck_in_room.size(); ++i) {
+		if (stuck_in_room[i]) {
+			std::cout << "  timed out in room " << i << ": " << stuck_in_room[i] << "\n";
+		}
+	}
+	std::cout.flush();
+
+	return 0;
+}
@@ -1,10 +1,44 @@
 // Inspired by https://github.com/lassyla/game1/blob/master/pack_tiles.cpp
 // Reads PNG files in images directory as binary data and stores into tiles.bin,
 // which will be read into PlayMode to create the sprites and rooms
+//
+// Rebuilds are incremental: the converted output of every source PNG is kept in
+// tiles.cache, keyed by a hash of the PNG's bytes, so only changed images are
+// decoded again; and only the chunks of tiles.bin that actually changed are rewritten.
+//
+// Images are hashed, decoded and converted in parallel; results (and log messages)
+// are merged afterward in path order, so tiles.bin doesn't depend on the thread count.
+//
+// Sprites share palettes (colors are packed into at most 7 palettes, plus the background's),
+// and sprite tiles that match up to flipping and recoloring share one tile table entry;
+// the tile + attributes for each sprite are written as the "spr5" chunk (see SpriteTable.hpp).
+//
+// Sprite images can be any multiple of 8x8: they are sliced into 8x8 tiles, and drawn as one
+// PPU sprite per tile using the metasprite descriptors in the "met6" chunk.
+//
+// Rooms are every images/roomN.png (room0.png, room1.png, ... until one is missing); they are
+// all flattened into the "rms7" chunk (see read_write_flat.hpp).
+//
+// tiles.bin starts with a table of contents ("ctoc"), so the game can fetch chunks by name.
+//
+// usage: pack-tiles [-v] [-j threads] [-z codec] [-b]
+//   -v          print every converted palette, tile, and object
+//   -j threads  number of worker threads (default: one per core)
+//   -z codec    compress chunks with 'raw' (default), 'zlib', or 'lz'
+//   -b          time loading the chunks with each codec, compared to raw
 
 #include <vector>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <iterator>
+#include <array>
+#include <functional>
 #include <cstring>
+#include <cstddef>
 #include <fstream>
+#include <sstream>
+#include <chrono>
 #include <glm/glm.hpp>
 #include <glm/gtx/string_cast.hpp>
 
@@ -12,9 +46,644 @@
 #include "data_path.hpp"
 #include "load_save_png.hpp"
 #include "read_write_chunk.hpp"
+#include "read_write_flat.hpp"
 #include "Room.hpp"
+#include "SpriteTable.hpp"
+#include "ThreadPool.hpp"
+
+// Print per-pixel details while converting? (set by -v)
+static bool verbose = false;
+
+// Contents of a file, or empty if it can't be read
+static std::vector< char > read_file(std::string const &path) {
+	std::ifstream in(path, std::ios::binary);
+	return std::vector< char >(std::istreambuf_iterator< char >(in), std::istreambuf_iterator< char >());
+}
+
+// 64-bit FNV-1a hash of some bytes (pass a previous hash to continue hashing)
+static uint64_t hash_bytes(void const *data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL) {
+	for (size_t i = 0; i < size; i++) {
+		hash = (hash ^ reinterpret_cast< uint8_t const * >(data)[i]) * 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+// Converted output for each source PNG, keyed by path, from the last time CreateTiles ran
+struct AssetCache {
+	struct Entry {
+		uint64_t hash = 0;           // hash of PNG file contents
+		std::vector< char > output;  // converted data (tile + palette, or room objects)
+		bool used = false;           // looked up this run? (unused entries aren't saved)
+	};
+	std::map< std::string, Entry > entries;
+
+	// On-disk layout: "keys" holds paths, "ents" says where each entry's key + output live in "keys"/"outs"
+	struct EntryHeader {
+		uint64_t hash;
+		uint32_t key_begin, key_end;
+		uint32_t output_begin, output_end;
+	};
+	static_assert(sizeof(EntryHeader) == 24, "EntryHeader is packed");
+
+	void load(std::string const &path) {
+		std::ifstream in(path, std::ios::binary);
+		if (!in) return; // no cache yet
+		try {
+			std::vector< EntryHeader > headers;
+			std::vector< char > keys, outputs;
+			read_chunk(in, "ents", &headers);
+			read_chunk(in, "keys", &keys);
+			read_chunk(in, "outs", &outputs);
+			for (auto const &h : headers) {
+				if (h.key_begin > h.key_end || h.key_end > keys.size()
+				 || h.output_begin > h.output_end || h.output_end > outputs.size()) {
+					throw std::runtime_error("Cache entry out of range");
+				}
+				Entry &entry = entries[std::string(keys.begin() + h.key_begin, keys.begin() + h.key_end)];
+				entry.hash = h.hash;
+				entry.output.assign(outputs.begin() + h.output_begin, outputs.begin() + h.output_end);
+			}
+		} catch (std::exception const &e) {
+			std::cout << "Ignoring unreadable cache '" << path << "' (" << e.what() << ")" << std::endl;
+			entries.clear();
+		}
+	}
+
+	void save(std::string const &path) const {
+		std::vector< EntryHeader > headers;
+		std::vector< char > keys, outputs;
+		for (auto const &kv : entries) {
+			if (!kv.second.used) continue;
+			EntryHeader h;
+			h.hash = kv.second.hash;
+			h.key_begin = uint32_t(keys.size());
+			keys.insert(keys.end(), kv.first.begin(), kv.first.end());
+			h.key_end = uint32_t(keys.size());
+			h.output_begin = uint32_t(outputs.size());
+			outputs.insert(outputs.end(), kv.second.output.begin(), kv.second.output.end());
+			h.output_end = uint32_t(outputs.size());
+			headers.emplace_back(h);
+		}
+		std::ofstream out(path, std::ios::binary);
+		write_chunk("ents", headers, &out);
+		write_chunk("keys", keys, &out);
+		write_chunk("outs", outputs, &out);
+	}
+
+	// Previously converted output for 'path', if its contents still hash to 'hash'
+	// (read-only, so safe to call from several threads at once)
+	std::vector< char > const *find(std::string const &path, uint64_t hash) const {
+		auto f = entries.find(path);
+		if (f == entries.end() || f->second.hash != hash) return nullptr;
+		return &f->second.output;
+	}
+
+	// Remember converted output for 'path' (and keep it when the cache is saved)
+	void store(std::string const &path, uint64_t hash, std::vector< char > const &output) {
+		Entry &entry = entries[path];
+		entry.hash = hash;
+		entry.output = output;
+		entry.used = true;
+	}
+};
+
+// Reinterpret a vector of (trivially copyable) structures as bytes, and back again
+template< typename T >
+static std::vector< char > to_bytes(std::vector< T > const &from) {
+	std::vector< char > bytes(from.size() * sizeof(T));
+	if (!bytes.empty()) std::memcpy(bytes.data(), from.data(), bytes.size());
+	return bytes;
+}
+
+// (Object has padding, which must be zeroed so that output is deterministic)
+static std::vector< char > to_bytes(std::vector< Object > const &from) {
+	std::vector< char > bytes(from.size() * sizeof(Object), 0);
+	for (size_t i = 0; i < from.size(); i++) {
+		char *to = bytes.data() + i * sizeof(Object);
+		std::memcpy(to + offsetof(Object, obj_type), &from[i].obj_type, sizeof(from[i].obj_type));
+		std::memcpy(to + offsetof(Object, reached), &from[i].reached, sizeof(from[i].reached));
+		std::memcpy(to + offsetof(Object, x), &from[i].x, sizeof(from[i].x));
+		std::memcpy(to + offsetof(Object, y), &from[i].y, sizeof(from[i].y));
+	}
+	return bytes;
+}
+
+template< typename T >
+static std::vector< T > from_bytes(std::vector< char > const &bytes) {
+	if (bytes.size() % sizeof(T) != 0) throw std::runtime_error("Converted data has the wrong size");
+	std::vector< T > to(bytes.size() / sizeof(T));
+	if (!bytes.empty()) std::memcpy(to.data(), bytes.data(), bytes.size());
+	return to;
+}
+
+// Version of the converted output (bump when it changes, so stale tiles.cache entries aren't used)
+static const uint32_t ConvertVersion = 2;
+
+// One source image to convert
+struct Job {
+	typedef std::function< std::vector< char >(glm::uvec2 const &, std::vector< glm::u8vec4 > const &, std::ostream &) > Convert;
+	Job(std::string const &path_, Convert const &convert_)
+		: path(path_), convert(convert_) { }
+	std::string path;
+	Convert convert; // (image size, pixels with upper-left origin, log) -> output
+
+	// Filled in by run_jobs():
+	uint64_t hash = 0;
+	std::vector< char > output; // converted data
+	std::string log;            // messages, printed in job order once every job is done
+	bool converted = false;     // false if output came from the cache
+	bool failed = false;
+};
+
+// Hash, decode, and convert every job in parallel, using the cache where possible
+static void run_jobs(std::vector< Job > &jobs, AssetCache &cache, ThreadPool &pool) {
+	pool.parallel_for(jobs.size(), [&](size_t i) {
+		Job &job = jobs[i];
+		try {
+			std::vector< char > file = read_file(job.path);
+			if (file.empty()) throw std::runtime_error("Failed to read '" + job.path + "'");
+			job.hash = hash_bytes(&ConvertVersion, sizeof(ConvertVersion), hash_bytes(file.data(), file.size()));
+
+			if (std::vector< char > const *cached = cache.find(job.path, job.hash)) {
+				job.output = *cached;
+				return;
+			}
+
+			std::ostringstream log;
+			log << job.path << "\n";
+			glm::uvec2 size;
+			std::vector< glm::u8vec4 > data;
+			load_png(job.path, &size, &data, UpperLeftOrigin);
+			job.output = job.convert(size, data, log);
+			job.log = log.str();
+			job.converted = true;
+		} catch (std::exception const &e) {
+			job.log = "ERROR: " + job.path + ": " + e.what() + "\n";
+			job.failed = true;
+		}
+	});
+
+	// Merge (in job order, so output doesn't depend on thread timing)
+	uint32_t converted = 0;
+	for (auto const &job : jobs) {
+		std::cout << job.log;
+		if (job.failed) throw std::runtime_error("Failed to convert '" + job.path + "'");
+		cache.store(job.path, job.hash, job.output);
+		if (job.converted) converted++;
+	}
+	std::cout << "Converted " << converted << " changed image(s) of " << jobs.size() << std::endl;
+}
+
+// Converted form of one 8x8 tile of a sprite image
+struct Sprite {
+	PPU466::Palette palette;
+	PPU466::Tile tile;
+};
+static_assert(sizeof(Sprite) == 32, "Sprite is packed");
+
+// One (non-empty) 8x8 tile of a sprite image, and where it goes (in pixels from the image's lower-left)
+struct SheetTile {
+	Sprite sprite;
+	uint8_t x, y;
+};
+static_assert(sizeof(SheetTile) == 34, "SheetTile is packed");
+
+static uint32_t pack_color(glm::u8vec4 const &c) {
+	return uint32_t(c.r) | (uint32_t(c.g) << 8) | (uint32_t(c.b) << 16) | (uint32_t(c.a) << 24);
+}
+
+static glm::u8vec4 unpack_color(uint32_t c) {
+	return glm::u8vec4(c & 0xff, (c >> 8) & 0xff, (c >> 16) & 0xff, (c >> 24) & 0xff);
+}
+
+// Build a 4-color palette (in first-seen order) and tile from the 8x8 block of 'pixels' at (ox,oy)
+// ('pixels' are packed colors, 'width' per row, rows from bottom to top)
+static Sprite convert_tile(std::vector< uint32_t > const &pixels, uint32_t width, uint32_t ox, uint32_t oy, std::ostream &log) {
+	std::array< uint32_t, 4 > colors = { 0, 0, 0, 0 };
+	uint32_t colors_found = 0; // Keeps track of how many colors we've added to palette
+
+	Sprite sprite;
+	for (uint32_t y = 0; y < 8; y++) {
+		uint32_t const *row = &pixels[(oy + y) * width + ox];
+
+		// Add colors we haven't seen yet to the palette
+		for (uint32_t x = 0; x < 8; x++) {
+			uint32_t c = 0;
+			while (c < colors_found && colors[c] != row[x]) c++;
+			if (c == colors_found) {
+				if (colors_found == 4) {
+					throw std::runtime_error("Tile at (" + std::to_string(ox) + ", " + std::to_string(oy) + ") has more than 4 colors");
+				}
+				colors[colors_found++] = row[x];
+			}
+		}
+
+		// Build both bit planes a whole row at a time (no branches, so this vectorizes well):
+		uint8_t bit0 = 0, bit1 = 0;
+		for (uint32_t c = 1; c < 4; c++) {
+			uint8_t match = 0;
+			for (uint32_t x = 0; x < 8; x++) {
+				match |= uint8_t(row[x] == colors[c] && c < colors_found) << x;
+			}
+			bit0 |= (c & 1) ? match : 0;
+			bit1 |= (c & 2) ? match : 0;
+		}
+		sprite.tile.bit0[y] = bit0;
+		sprite.tile.bit1[y] = bit1;
+	}
+	for (uint32_t c = 0; c < 4; c++) {
+		sprite.palette[c] = (c < colors_found ? unpack_color(colors[c]) : glm::u8vec4(0x00, 0x00, 0x00, 0x00));
+	}
+
+	if (verbose) {
+		log << "Printing palette: \n";
+		for (int j = 0; j < 4; j++) {
+			log << j << ": " << glm::to_string(sprite.palette[j]) << "\n";
+		}
+		log << "Printing tile: \n";
+		for (int j = 0; j < 8; j++) {
+			log << j << ": " << unsigned(sprite.tile.bit1[j]) << ", " << unsigned(sprite.tile.bit0[j]) << "\n";
+		}
+	}
+
+	return sprite;
+}
+
+// Slice a sprite image (any multiple of 8 pixels on a side, up to 256x256) into 8x8 tiles,
+// bottom row first, skipping fully transparent tiles
+static std::vector< SheetTile > convert_sheet(glm::uvec2 const &size, std::vector< glm::u8vec4 > const &data, std::ostream &log) {
+	if (size.x % 8 != 0 || size.y % 8 != 0 || size.x == 0 || size.y == 0 || size.x > 256 || size.y > 256) {
+		throw std::runtime_error("Sprite image is " + std::to_string(size.x) + "x" + std::to_string(size.y) + "; expected a multiple of 8x8, at most 256x256");
+	}
+
+	// Pack colors and flip rows so y goes up, like tile rows do:
+	std::vector< uint32_t > pixels(data.size());
+	for (uint32_t y = 0; y < size.y; y++) {
+		glm::u8vec4 const *row = &data[(size.y - 1 - y) * size.x];
+		for (uint32_t x = 0; x < size.x; x++) {
+			pixels[y * size.x + x] = pack_color(row[x]);
+		}
+	}
+
+	std::vector< SheetTile > tiles;
+	for (uint32_t oy = 0; oy < size.y; oy += 8) {
+		for (uint32_t ox = 0; ox < size.x; ox += 8) {
+			uint32_t opaque = 0;
+			for (uint32_t y = 0; y < 8; y++) {
+				for (uint32_t x = 0; x < 8; x++) {
+					opaque |= pixels[(oy + y) * size.x + ox + x] >> 24;
+				}
+			}
+			// (an entirely transparent image still gets one tile, so every sprite has one)
+			if (opaque == 0 && !(ox + 8 >= size.x && oy + 8 >= size.y && tiles.empty())) continue;
+
+			SheetTile tile;
+			tile.sprite = convert_tile(pixels, size.x, ox, oy, log);
+			tile.x = uint8_t(ox);
+			tile.y = uint8_t(oy);
+			tiles.emplace_back(tile);
+		}
+	}
+	if (verbose) {
+		log << "Sliced " << size.x << "x" << size.y << " image into " << tiles.size() << " tile(s)\n";
+	}
+
+	return tiles;
+}
+
+// Color index (0-3) of pixel (x,y) in a tile
+static uint8_t tile_pixel(PPU466::Tile const &tile, uint32_t x, uint32_t y) {
+	return uint8_t(((tile.bit0[y] >> x) & 1) | (((tile.bit1[y] >> x) & 1) << 1));
+}
+
+// A tile as drawn with the given flips, with its color indices renumbered in first-seen order.
+// Two tiles that differ only by flips and palette order have the same canonical tile.
+static PPU466::Tile canonical_tile(PPU466::Tile const &tile, bool flip_x, bool flip_y) {
+	std::array< uint8_t, 4 > relabel;
+	std::array< bool, 4 > seen = { false, false, false, false };
+	uint8_t next = 0;
+	PPU466::Tile out;
+	for (uint32_t y = 0; y < 8; y++) {
+		out.bit0[y] = 0;
+		out.bit1[y] = 0;
+		for (uint32_t x = 0; x < 8; x++) {
+			uint8_t old_idx = tile_pixel(tile, flip_x ? 7 - x : x, flip_y ? 7 - y : y);
+			if (!seen[old_idx]) {
+				seen[old_idx] = true;
+				relabel[old_idx] = next++;
+			}
+			uint8_t idx = relabel[old_idx];
+			out.bit0[y] |= (idx & 0b1) << x;
+			out.bit1[y] |= ((idx >> 1) & 0b1) << x;
+		}
+	}
+	return out;
+}
+
+// Colors as sorted sets of packed RGBA values (at most 4 per palette)
+typedef std::vector< uint32_t > ColorSet;
+
+// The colors a sprite actually uses
+static ColorSet sprite_colors(Sprite const &sprite) {
+	ColorSet colors;
+	for (uint32_t y = 0; y < 8; y++) {
+		for (uint32_t x = 0; x < 8; x++) {
+			colors.push_back(pack_color(sprite.palette[tile_pixel(sprite.tile, x, y)]));
+		}
+	}
+	std::sort(colors.begin(), colors.end());
+	colors.erase(std::unique(colors.begin(), colors.end()), colors.end());
+	return colors;
+}
+
+static bool is_subset(ColorSet const &a, ColorSet const &b) {
+	return std::includes(b.begin(), b.end(), a.begin(), a.end());
+}
+
+// Share palettes between sprites: group the sprites' color sets into at most 'max_palettes'
+// palettes of 4 colors, then rewrite each sprite's tile to index into its shared palette.
+// 'fixed' palettes (e.g. the background's) can be used by sprites whose colors they contain,
+// but aren't changed. Returns the shared palettes; palette_of[i] gets sprite i's palette,
+// counting shared palettes first, then fixed ones.
+//
+// This is a set-cover style heuristic: identical color sets are merged, sets contained in
+// another set are dropped (parallel pairwise test), and the rest are placed largest first
+// into whichever palette they grow the least ("best fit"), opening a new palette if none fits.
+static std::vector< PPU466::Palette > pack_palettes(std::vector< Sprite > *sprites_, std::vector< PPU466::Palette > const &fixed,
+	uint32_t max_palettes, ThreadPool &pool, std::vector< uint8_t > *palette_of) {
+
+	auto &sprites = *sprites_;
+
+	std::vector< ColorSet > sprite_sets(sprites.size());
+	pool.parallel_for(sprites.size(), [&](size_t i) {
+		sprite_sets[i] = sprite_colors(sprites[i]);
+	}, 64);
+
+	std::vector< ColorSet > fixed_sets;
+	for (auto const &palette : fixed) {
+		ColorSet set;
+		for (auto const &c : palette) set.push_back(pack_color(c));
+		std::sort(set.begin(), set.end());
+		set.erase(std::unique(set.begin(), set.end()), set.end());
+		fixed_sets.push_back(set);
+	}
+
+	// Unique color sets:
+	std::vector< ColorSet > sets(sprite_sets);
+	std::sort(sets.begin(), sets.end());
+	sets.erase(std::unique(sets.begin(), sets.end()), sets.end());
+
+	// Drop sets that another set (or a fixed palette) already covers:
+	std::vector< uint8_t > covered(sets.size(), 0);
+	pool.parallel_for(sets.size(), [&](size_t i) {
+		for (auto const &f : fixed_sets) {
+			if (is_subset(sets[i], f)) { covered[i] = 1; return; }
+		}
+		for (size_t j = 0; j < sets.size(); j++) {
+			if (j != i && sets[j].size() > sets[i].size() && is_subset(sets[i], sets[j])) { covered[i] = 1; return; }
+		}
+	}, 16);
+	std::vector< ColorSet > todo;
+	for (size_t i = 0; i < sets.size(); i++) {
+		if (!covered[i]) todo.emplace_back(std::move(sets[i]));
+	}
+	std::stable_sort(todo.begin(), todo.end(), [](ColorSet const &a, ColorSet const &b) {
+		return a.size() > b.size();
+	});
+
+	// Best-fit packing into palettes:
+	std::vector< ColorSet > bins;
+	for (auto const &set : todo) {
+		size_t best = bins.size();
+		size_t best_growth = 5;
+		for (size_t b = 0; b < bins.size(); b++) {
+			ColorSet merged;
+			std::set_union(bins[b].begin(), bins[b].end(), set.begin(), set.end(), std::back_inserter(merged));
+			if (merged.size() <= 4 && merged.size() - bins[b].size() < best_growth) {
+				best = b;
+				best_growth = merged.size() - bins[b].size();
+			}
+		}
+		if (best == bins.size()) {
+			if (bins.size() >= max_palettes) {
+				throw std::runtime_error("Sprites need more than " + std::to_string(max_palettes) + " palettes (" + std::to_string(todo.size()) + " distinct color sets)");
+			}
+			bins.emplace_back(set);
+		} else {
+			ColorSet merged;
+			std::set_union(bins[best].begin(), bins[best].end(), set.begin(), set.end(), std::back_inserter(merged));
+			bins[best] = merged;
+		}
+	}
+
+	std::vector< PPU466::Palette > palettes(bins.size());
+	for (size_t b = 0; b < bins.size(); b++) {
+		for (size_t c = 0; c < 4; c++) {
+			uint32_t packed = (c < bins[b].size() ? bins[b][c] : 0);
+			palettes[b][c] = unpack_color(packed);
+		}
+	}
+
+	// Remap every sprite's tile into (the first) palette that holds all of its colors:
+	palette_of->assign(sprites.size(), 0);
+	pool.parallel_for(sprites.size(), [&](size_t i) {
+		Sprite &sprite = sprites[i];
+		size_t p = 0;
+		while (p < bins.size() && !is_subset(sprite_sets[i], bins[p])) p++;
+		if (p == bins.size()) {
+			while (p - bins.size() < fixed_sets.size() && !is_subset(sprite_sets[i], fixed_sets[p - bins.size()])) p++;
+		}
+		PPU466::Palette const &palette = (p < bins.size() ? palettes[p] : fixed.at(p - bins.size()));
+
+		std::array< uint8_t, 4 > remap = { 0, 0, 0, 0 };
+		for (uint8_t c = 0; c < 4; c++) {
+			while (remap[c] < 3 && palette[remap[c]] != sprite.palette[c]) remap[c]++;
+		}
+		for (uint32_t y = 0; y < 8; y++) {
+			uint8_t bit0 = 0, bit1 = 0;
+			for (uint32_t x = 0; x < 8; x++) {
+				uint8_t idx = remap[tile_pixel(sprite.tile, x, y)];
+				bit0 |= (idx & 0b1) << x;
+				bit1 |= ((idx >> 1) & 0b1) << x;
+			}
+			sprite.tile.bit0[y] = bit0;
+			sprite.tile.bit1[y] = bit1;
+		}
+		sprite.palette = palette;
+		(*palette_of)[i] = uint8_t(p);
+	}, 64);
+
+	return palettes;
+}
+
+// Does 'tile' drawn with these flips and 'palette' look exactly like 'sprite'?
+static bool draws_as(PPU466::Tile const &tile, bool flip_x, bool flip_y, PPU466::Palette const &palette, Sprite const &sprite) {
+	for (uint32_t y = 0; y < 8; y++) {
+		for (uint32_t x = 0; x < 8; x++) {
+			if (palette[tile_pixel(tile, flip_x ? 7 - x : x, flip_y ? 7 - y : y)] != sprite.palette[tile_pixel(sprite.tile, x, y)]) return false;
+		}
+	}
+	return true;
+}
+
+// Put each sprite's tile into the tile table, reusing an existing tile when it draws the sprite
+// (with some flip, in the sprite's palette). palette_of[i] is the palette index for sprite i.
+// Returns how to draw each sprite.
+static std::vector< SpriteRef > pack_sprites(std::vector< Sprite > const &sprites, std::vector< uint8_t > const &palette_of,
+	std::vector< PPU466::Tile > *tile_table, uint32_t *merged) {
+
+	std::vector< SpriteRef > refs(sprites.size());
+	std::unordered_map< uint64_t, std::vector< uint8_t > > slots_by_hash; // canonical tile hash -> tile table slots
+	uint32_t used = 0;
+	*merged = 0;
+
+	for (size_t i = 0; i < sprites.size(); i++) {
+		Sprite const &sprite = sprites[i];
+
+		// Look for an existing tile matching any flip of this one (unflipped first)
+		uint8_t flips = 0;
+		bool found = false;
+		for (uint8_t f = 0; f < 4 && !found; f++) {
+			bool flip_x = (f & 1) != 0;
+			bool flip_y = (f & 2) != 0;
+			PPU466::Tile tile = canonical_tile(sprite.tile, flip_x, flip_y);
+			for (uint8_t candidate : slots_by_hash[hash_bytes(&tile, sizeof(tile))]) {
+				// (flipping is its own inverse, so the candidate flipped the same way should draw the sprite)
+				if (draws_as((*tile_table)[candidate], flip_x, flip_y, sprite.palette, sprite)) {
+					refs[i].index = candidate;
+					flips = f;
+					found = true;
+					break;
+				}
+			}
+		}
+
+		if (found) {
+			(*merged)++;
+		} else {
+			if (used >= 255) throw std::runtime_error("Too many sprite tiles; the last tile is reserved for the background");
+			(*tile_table)[used] = sprite.tile;
+			PPU466::Tile tile = canonical_tile(sprite.tile, false, false);
+			slots_by_hash[hash_bytes(&tile, sizeof(tile))].push_back(uint8_t(used));
+			refs[i].index = uint8_t(used);
+			used++;
+		}
+
+		refs[i].attributes = palette_of[i] | ((flips & 1) ? 0x08 : 0x00) | ((flips & 2) ? 0x10 : 0x00);
+	}
+
+	return refs;
+}
+
+// Unpack the objects described by a room image
+static std::vector< Object > convert_room(std::vector< glm::u8vec4 > const &data, std::ostream &log) {
+	std::vector< Object > objects;
+
+	size_t num_objects = 0;
+
+	while (num_objects < data.size() && data[num_objects].w != 0x00) { // Alpha value -- if transparent, it's not info
+		Object new_obj;
+		new_obj.obj_type = data[num_objects].x; // Stored in PNG as R value
+		new_obj.x        = data[num_objects].y; // Stored in PNG as G value
+		new_obj.y        = data[num_objects].z; // Stored in PNG as B value
+		if (verbose) {
+			log << "Unpacking a new object" << "\n";
+			log << "A value: " << unsigned(data[num_objects].w) << "\n";
+			log << "R value: " << unsigned(new_obj.obj_type) << "\n";
+			log << "G value: " << unsigned(new_obj.x) << "\n";
+			log << "B value: " << unsigned(new_obj.y) << "\n";
+		}
+
+		objects.push_back(new_obj);
+
+		num_objects++;
+	}
+
+	return objects;
+}
+
+// Write 'bytes' to 'path', touching only the chunks that differ from what's already there
+// (falls back to rewriting the whole file if the chunk layout changed)
+static void patch_file(std::string const &path, std::string const &bytes) {
+	std::vector< char > old = read_file(path);
+
+	if (old.size() != bytes.size()) {
+		std::cout << "Writing " << path << " (" << bytes.size() << " bytes)" << std::endl;
+		std::ofstream out(path, std::ios::binary);
+		out.write(bytes.data(), bytes.size());
+		return;
+	}
+
+	std::fstream out;
+	uint32_t patched = 0;
+	for (size_t at = 0; at + 8 <= bytes.size(); ) {
+		uint32_t size;
+		std::memcpy(&size, bytes.data() + at + 4, 4);
+		size &= ~ChunkCompressedBit;
+		size_t end = std::min(bytes.size(), at + 8 + size);
+		if (std::memcmp(old.data() + at, bytes.data() + at, end - at) != 0) {
+			if (!out.is_open()) out.open(path, std::ios::binary | std::ios::in | std::ios::out);
+			out.seekp(at);
+			out.write(bytes.data() + at, end - at);
+			std::cout << "Patched chunk '" << bytes.substr(at, 4) << "' in " << path << std::endl;
+			patched++;
+		}
+		at = end;
+	}
+	if (patched == 0) {
+		std::cout << path << " is up to date" << std::endl;
+	}
+}
+
+// Time reading every chunk written by write_chunks (with each codec) back out of memory
+static void benchmark_codecs(std::function< void(ChunkCodec, std::ostream *) > const &write_chunks, std::vector< std::string > const &magics) {
+	double raw_seconds = 0.0;
+	for (ChunkCodec codec : { ChunkRaw, ChunkZlib, ChunkLZ }) {
+		std::ostringstream out;
+		write_chunks(codec, &out);
+		std::string const bytes = out.str();
+
+		std::vector< std::vector< char > > loaded(magics.size());
+		uint64_t loaded_bytes = 0;
+		const uint32_t Iterations = 2000;
+		auto before = std::chrono::high_resolution_clock::now();
+		for (uint32_t iteration = 0; iteration < Iterations; iteration++) {
+			std::istringstream in(bytes);
+			for (size_t m = 0; m < magics.size(); m++) {
+				read_chunk(in, magics[m], &loaded[m]);
+				loaded_bytes += loaded[m].size();
+			}
+		}
+		auto after = std::chrono::high_resolution_clock::now();
+		double seconds = std::chrono::duration< double >(after - before).count() / Iterations;
+		if (codec == ChunkRaw) raw_seconds = seconds;
+
+		std::cout << "  " << chunk_codec_name(codec) << ": " << bytes.size() << " bytes, "
+		          << (seconds * 1e6) << " us per load (" << (seconds / raw_seconds) << "x raw), "
+		          << (double(loaded_bytes) / Iterations / seconds / 1e6) << " MB/s" << std::endl;
+	}
+}
 
 int main(int argc, char** argv) {
+	uint32_t threads = 0;
+	ChunkCodec codec = ChunkRaw;
+	bool benchmark = false;
+	for (int a = 1; a < argc; a++) {
+		std::string arg = argv[a];
+		if (arg == "-v") {
+			verbose = true;
+		} else if (arg == "-j" && a + 1 < argc) {
+			threads = uint32_t(std::stoul(argv[++a]));
+		} else if (arg == "-z" && a + 1 < argc) {
+			codec = chunk_codec(argv[++a]);
+		} else if (arg == "-b") {
+			benchmark = true;
+		} else {
+			std::cerr << "usage: " << argv[0] << " [-v] [-j threads] [-z codec] [-b]" << std::endl;
+			return 1;
+		}
+	}
+
 	std::cout << "Hey bestie... \n";
 	// Initialize palette and tile tables -- will be packed in same order as path arrays,
 	// i.e., sprite_paths and room_paths. Last palette and tile are reserved for background
@@ -32,25 +701,45 @@ int main(int argc, char** argv) {
 									"../images/explosion.png",
 									"../images/door.png"}; // Update for loop count if adding sprites
 
-	int num_rooms = 3;
-	std::string room_paths[3] = { "../images/room0.png",
-								  "../images/room1.png",
-								  "../images/room2.png"};
+	// Rooms are every images/roomN.png, counting up from room0.png
+	std::vector< std::string > room_paths;
+	while (std::ifstream(data_path("../images/room" + std::to_string(room_paths.size()) + ".png"))) {
+		room_paths.emplace_back("../images/room" + std::to_string(room_paths.size()) + ".png");
+	}
+	if (room_paths.empty()) throw std::runtime_error("No rooms found (expected images/room0.png)");
+	int num_rooms = int(room_paths.size());
 
 	std::string bg_path = "../images/background.png";
 
-	// Binary data to be read in from PNGs
-	std::vector< glm::u8vec4 > data;
+	AssetCache cache;
+	cache.load(data_path("../tiles.cache"));
+
+	// Convert everything (background first, then sprites, then rooms)
+	std::vector< Job > jobs;
+	jobs.emplace_back(data_path(bg_path), [](glm::uvec2 const &, std::vector< glm::u8vec4 > const &data, std::ostream &) {
+		// Background palette is stored as the first two pixels
+		return to_bytes(std::vector< glm::u8vec4 >{ data[0], data[1] });
+	});
+	for (int i = 0; i < num_sprites; i++) {
+		jobs.emplace_back(data_path(sprite_paths[i]), [](glm::uvec2 const &size, std::vector< glm::u8vec4 > const &data, std::ostream &log) {
+			return to_bytes(convert_sheet(size, data, log));
+		});
+	}
+	for (int i = 0; i < num_rooms; i++) {
+		jobs.emplace_back(data_path(room_paths[i]), [](glm::uvec2 const &, std::vector< glm::u8vec4 > const &data, std::ostream &log) {
+			return to_bytes(convert_room(data, log));
+		});
+	}
 
-	// Size of all PNGs is 8x8 pixels
-	glm::uvec2 size = glm::uvec2(8, 8); // Change if you make bigger sprites
+	ThreadPool pool(threads);
+	run_jobs(jobs, cache, pool);
 
 	// Load background palette
-	load_png(data_path(bg_path), &size, &data, UpperLeftOrigin);
+	std::vector< glm::u8vec4 > bg_colors = from_bytes< glm::u8vec4 >(jobs[0].output);
 	PPU466::Palette bg_palette = {
 		glm::u8vec4(0x00, 0x00, 0x00, 0x00),
-		data[0],
-		data[1],
+		bg_colors[0],
+		bg_colors[1],
 		glm::u8vec4(0x00, 0x00, 0x00, 0x00)
 	};
 	palette_table[7] = bg_palette;
@@ -62,105 +751,78 @@ int main(int argc, char** argv) {
 	}
 	tile_table[255] = bg_tile;
 
-	// Load sprite PNGs
+	// Add sprite palettes and tiles to tables (same order as sprite_paths)
+	// (every tile of every sprite image is packed on its own; 'pieces' remembers where each goes)
+	static_assert(SpriteCount == 7, "SpriteId matches sprite_paths");
+	std::vector< Sprite > sprites;
+	std::vector< MetaspriteTile > pieces;
 	for (int i = 0; i < num_sprites; i++) {
-		std::cout << sprite_paths[i] << std::endl;
-		load_png(data_path(sprite_paths[i]), &size, &data, UpperLeftOrigin); // TODO: Upper or LowerLeftOrigin?
-
-		PPU466::Palette palette = {
-			glm::u8vec4(0x00, 0x00, 0x00, 0x00),
-			glm::u8vec4(0x00, 0x00, 0x00, 0x00),
-			glm::u8vec4(0x00, 0x00, 0x00, 0x00),
-			glm::u8vec4(0x00, 0x00, 0x00, 0x00),
-		};
-
-		PPU466::Tile tile;
-		tile.bit0 = { 0, 0, 0, 0, 0, 0, 0, 0 };
-		tile.bit1 = { 0, 0, 0, 0, 0, 0, 0, 0 };
-
-		// Loop through every pixel
-		int colors_found = 0; // Keeps track of how many colors we've added to palette
-		for (uint8_t y = 0; y < 8; y++) { // Change if you make bigger sprites
-			for (uint8_t x = 0; x < 8; x++) {
-				glm::u8vec4 pixel_color = data[(8 * (7 - y)) + x];
-
-				// If this color is already in our palette, get palette index
-				bool in_palette = false;
-				for (uint8_t palette_idx = 0; palette_idx < colors_found; palette_idx++) {
-					if (pixel_color == palette[palette_idx]) {
-						in_palette = true;
-						uint8_t palette_idx_bit0 = palette_idx & 0b1;
-						uint8_t palette_idx_bit1 = (palette_idx >> 1) & 0b1;
-						tile.bit0[y] = tile.bit0[y] | (palette_idx_bit0 << x);
-						tile.bit1[y] = tile.bit1[y] | (palette_idx_bit1 << x);
-					}
-				}
-				// If the color is not in our palette, add it to the palette
-				if (!in_palette) {
-					palette[colors_found] = pixel_color;
-					uint8_t palette_idx_bit0 = colors_found & 0b1;
-					uint8_t palette_idx_bit1 = (colors_found >> 1) & 0b1;
-					tile.bit0[y] = tile.bit0[y] | (palette_idx_bit0 << x);
-					tile.bit1[y] = tile.bit1[y] | (palette_idx_bit1 << x);
-
-					colors_found++;
-				}
-			}
-		}
-		// Add palette to palette table (same order as sprite_paths)
-		palette_table[i] = palette;
-		std::cout << "Printing palette: \n";
-		for (int j = 0; j < 4; j++) {
-			std::cout << j << ": " << glm::to_string(palette[j]) << std::endl;
+		for (SheetTile const &tile : from_bytes< SheetTile >(jobs[1 + i].output)) {
+			sprites.push_back(tile.sprite);
+			MetaspriteTile piece;
+			piece.sprite = uint8_t(i);
+			piece.x = tile.x;
+			piece.y = tile.y;
+			pieces.push_back(piece);
 		}
+	}
 
-		// Add tile to tile table (same order as sprite_paths)
-		tile_table[i] = tile;
-		std::cout << "Printing tile: \n";
-		for (int j = 0; j < 8; j++) {
-			std::cout << j << ": " << unsigned(tile.bit1[j]) << ", " << unsigned(tile.bit0[j]) << "\n";
-		}
+	// Sprites share palettes 0-6 (and can use the background's palette if it has their colors)
+	std::vector< uint8_t > palette_of;
+	std::vector< PPU466::Palette > shared = pack_palettes(&sprites, { bg_palette }, 7, pool, &palette_of);
+	for (size_t p = 0; p < shared.size(); p++) {
+		palette_table[p] = shared[p];
+	}
+	for (auto &p : palette_of) {
+		if (p == shared.size()) p = 7; // (the fixed background palette)
 	}
+	std::cout << "Palette table: " << shared.size() << " of 7 sprite palettes used by " << sprites.size() << " sprite tiles" << std::endl;
 
-	for (int i = 0; i < num_rooms; i++) {
-		std::cout << room_paths[i] << std::endl;
-		load_png(data_path(room_paths[i]), &size, &data, UpperLeftOrigin);
+	uint32_t merged = 0;
+	std::vector< SpriteRef > tile_refs = pack_sprites(sprites, palette_of, &tile_table, &merged);
+	std::cout << "Tile table: " << (sprites.size() - merged + 1) << " of " << tile_table.size()
+	          << " tiles used (" << merged << " merged)" << std::endl;
+
+	// Metasprite descriptors (all tiles), and the first tile of each sprite:
+	std::vector< SpriteRef > sprite_table(num_sprites);
+	for (size_t t = pieces.size(); t > 0; t--) {
+		pieces[t-1].index = tile_refs[t-1].index;
+		pieces[t-1].attributes = tile_refs[t-1].attributes;
+		sprite_table[pieces[t-1].sprite] = tile_refs[t-1];
+	}
 
+	for (int i = 0; i < num_rooms; i++) {
 		Room new_room;
+		new_room.objects = from_bytes< Object >(jobs[1 + num_sprites + i].output);
+		rooms.push_back(new_room);
+	}
+	std::cout << "Rooms: " << rooms.size() << std::endl;
 
-		int num_objects = 0;
+	// Write binary to tiles.bin (chunks, then a table of contents in front of them)
+	// (all the rooms -- each a struct with its own vector of objects -- are flattened into one chunk)
+	auto write_chunks = [&](ChunkCodec chunk_codec, std::ostream *to) {
+		write_chunk("pal0", palette_table, to, chunk_codec);
+		write_chunk("til1", tile_table, to, chunk_codec);
+		write_chunk("spr5", sprite_table, to, chunk_codec);
+		write_chunk("met6", pieces, to, chunk_codec);
+		std::vector< char > rooms_blob{ char(RoomsVersion & 0xff), char((RoomsVersion >> 8) & 0xff), char((RoomsVersion >> 16) & 0xff), char((RoomsVersion >> 24) & 0xff) };
+		std::vector< char > flat_rooms = flatten(rooms);
+		rooms_blob.insert(rooms_blob.end(), flat_rooms.begin(), flat_rooms.end());
+		write_chunk("rms7", rooms_blob, to, chunk_codec);
+	};
+	std::ostringstream chunks;
+	write_chunks(codec, &chunks);
 
-		while (data[num_objects].w != 0x00) { // Alpha value -- if transparent, it's not info
-			std::cout << "Unpacking a new object" << std::endl;
-			std::cout << "A value: " << unsigned(data[num_objects].w) << std::endl;
-			Object new_obj;
-			new_obj.obj_type = data[num_objects].x; // Stored in PNG as R value
-			std::cout << "R value: " << unsigned(new_obj.obj_type) << std::endl;
-			new_obj.x        = data[num_objects].y; // Stored in PNG as G value
-			std::cout << "G value: " << unsigned(new_obj.x) << std::endl;
-			new_obj.y        = data[num_objects].z; // Stored in PNG as B value
-			std::cout << "B value: " << unsigned(new_obj.y) << std::endl;
+	if (benchmark) {
+		std::cout << "Loading chunks from memory:" << std::endl;
+		benchmark_codecs(write_chunks, { "pal0", "til1", "spr5", "met6", "rms7" });
+	}
 
-			new_room.objects.push_back(new_obj);
+	std::ostringstream out;
+	write_chunk_directory(chunks.str(), &out);
+	out << chunks.str();
 
-			num_objects++;
-		}
+	patch_file(data_path("../tiles.bin"), out.str());
 
-		rooms.push_back(new_room);
-		//DON'T FORGET TO WRITE_CHUNK BELOW
-	}
-
-	// Write binary to tiles.bin
-	std::ofstream out(data_path("../tiles.bin"), std::ios::binary);
-	write_chunk("pal0", palette_table, &out);
-	write_chunk("til1", tile_table,    &out);
-	//write_chunk("rom2", rooms,         &out); // For some reason, there was a problem
-												// reading this in PlayMode...? I suspect
-												// it has something to do with how rooms
-												// is a vector of structs, each containing
-												// its own vector of structs
-	write_chunk("rom2", rooms[0].objects, &out);
-	write_chunk("rom3", rooms[1].objects, &out);
-	write_chunk("rom4", rooms[2].objects, &out);
-
-}
\ No newline at end of file
+	cache.save(data_path("../tiles.cache"));
+}
@@ -0,0 +1,147 @@
+#include "FrameCapture.hpp"
+
+#include "gl_state.hpp"
+#include "load_save_png.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+FrameCapture::FrameCapture(uint32_t ring_size, uint32_t max_encoding_) : ring(std::max(1U, ring_size)), max_encoding(std::max(1U, max_encoding_)) {
+}
+
+FrameCapture::~FrameCapture() {
+	if (!in_flight.empty()) {
+		std::cerr << "WARNING: FrameCapture destroyed with " << in_flight.size() << " frames still being read back (call finish() first)." << std::endl;
+	}
+	encoders.reset(); //(finishes every queued encode)
+}
+
+void FrameCapture::screenshot(std::string const &filename) {
+	pending_screenshot = filename;
+}
+
+void FrameCapture::start_sequence(std::string const &prefix) {
+	sequence = true;
+	sequence_prefix = prefix;
+	sequence_frame = 0;
+}
+
+void FrameCapture::stop_sequence() {
+	sequence = false;
+}
+
+void FrameCapture::end_frame(glm::uvec2 const &drawable_size) {
+	//encode earlier frames the GPU has finished with:
+	while (collect_oldest(false)) { }
+
+	if (!pending_screenshot.empty()) {
+		start_readback(drawable_size, pending_screenshot);
+		pending_screenshot.clear();
+	}
+	if (sequence) {
+		char number[16];
+		std::snprintf(number, sizeof(number), "%06u", sequence_frame);
+		sequence_frame += 1;
+		start_readback(drawable_size, sequence_prefix + number + ".png");
+	}
+}
+
+void FrameCapture::finish() {
+	while (collect_oldest(true)) { }
+	if (encoders) encoders->wait();
+	for (auto &readback : ring) {
+		if (readback.buffer != 0) {
+			glDeleteBuffers(1, &readback.buffer);
+			readback.buffer = 0;
+			readback.buffer_size = 0;
+		}
+	}
+}
+
+void FrameCapture::start_readback(glm::uvec2 const &size, std::string const &filename) {
+	//every slot busy? wait for the oldest, rather than drop a frame:
+	if (in_flight.size() == ring.size()) collect_oldest(true);
+
+	size_t index = 0;
+	while (ring[index].fence != 0) ++index;
+	assert(index < ring.size());
+	Readback &readback = ring[index];
+
+	if (readback.buffer == 0) glGenBuffers(1, &readback.buffer);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+	size_t bytes = size_t(size.x) * size_t(size.y) * 4;
+	if (readback.buffer_size != bytes) {
+		glBufferData(GL_PIXEL_PACK_BUFFER, GLsizeiptr(bytes), nullptr, GL_STREAM_READ);
+		readback.buffer_size = bytes;
+	}
+
+	//(with a pack buffer bound, glReadPixels just queues a copy into it and returns)
+	gl_state().bind_framebuffer(GL_READ_FRAMEBUFFER, 0);
+	glReadBuffer(GL_BACK);
+	glReadPixels(0, 0, GLsizei(size.x), GLsizei(size.y), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	readback.size = size;
+	readback.filename = filename;
+	in_flight.emplace_back(index);
+}
+
+bool FrameCapture::collect_oldest(bool wait) {
+	if (in_flight.empty()) return false;
+	Readback &readback = ring[in_flight.front()];
+
+	//(the flush makes sure the fence reaches the GPU, so waiting on it can't wait forever)
+	GLenum status = glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? GL_TIMEOUT_IGNORED : 0);
+	if (status == GL_TIMEOUT_EXPIRED) return false;
+	if (status == GL_WAIT_FAILED) throw std::runtime_error("FrameCapture: waiting on a readback failed.");
+	glDeleteSync(readback.fence);
+	readback.fence = 0;
+	in_flight.pop_front();
+
+	//copy the pixels out, so the buffer can take another frame while this one encodes:
+	auto pixels = std::make_shared< std::vector< glm::u8vec4 > >(size_t(readback.size.x) * size_t(readback.size.y));
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+	void const *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, GLsizeiptr(readback.buffer_size), GL_MAP_READ_BIT);
+	if (mapped) std::memcpy(pixels->data(), mapped, readback.buffer_size);
+	glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	if (!mapped) {
+		std::cerr << "WARNING: couldn't map readback for '" << readback.filename << "'; it won't be saved." << std::endl;
+		return true;
+	}
+
+	//don't let encodes pile up without bound; wait for the encoders to catch up instead:
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		encoded.wait(lock, [this](){ return encoding < max_encoding; });
+		encoding += 1;
+	}
+
+	if (!encoders) {
+		uint32_t cores = std::thread::hardware_concurrency();
+		encoders.reset(new ThreadPool(cores > 1 ? cores - 1 : 1)); //(leave a core for the game)
+	}
+	glm::uvec2 size = readback.size;
+	std::string filename = readback.filename;
+	encoders->run([this,pixels,size,filename](){
+		try {
+			for (auto &px : *pixels) {
+				px.a = 0xff;
+			}
+			save_png(filename, size, pixels->data(), LowerLeftOrigin);
+		} catch (std::exception &e) {
+			std::cerr << "WARNING: failed to save '" << filename << "': " << e.what() << std::endl;
+		}
+		std::unique_lock< std::mutex > lock(mutex);
+		encoding -= 1;
+		encoded.notify_all();
+	});
+
+	return true;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+/*
+ * FrameCapture -- saves drawn frames as PNGs without stalling the frame that's being drawn.
+ *
+ * Each captured frame is read back into one of a ring of pixel buffer objects (so glReadPixels
+ *  returns right away), mapped a frame or two later once its fence says the GPU is done,
+ *  and encoded as a PNG on a pool of worker threads.
+ *
+ * FrameCapture capture;
+ * capture.screenshot("screenshot.png"); //save the next frame
+ * capture.start_sequence("capture-"); //save every frame, as capture-000000.png, capture-000001.png, ...
+ * //...every frame, after drawing (before swapping):
+ * capture.end_frame(drawable_size);
+ * //...before the OpenGL context goes away:
+ * capture.finish();
+ *
+ * Frames are never dropped: if the GPU or the encoders fall behind, end_frame() waits for them.
+ *
+ */
+
+#include "GL.hpp"
+#include "ThreadPool.hpp"
+
+#include <glm/glm.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct FrameCapture {
+	//'ring_size' readbacks can be in flight at once; 'max_encoding' frames can wait on (or be in) the encoders:
+	FrameCapture(uint32_t ring_size = 3, uint32_t max_encoding = 8);
+	~FrameCapture(); //waits for the encoders (call finish() first, while there's still an OpenGL context)
+
+	//save the next frame drawn to 'filename':
+	void screenshot(std::string const &filename);
+
+	//save every frame drawn (until stop_sequence()) to 'prefix' + frame number + ".png":
+	void start_sequence(std::string const &prefix);
+	void stop_sequence();
+	bool in_sequence() const { return sequence; }
+
+	//call once per frame, after drawing to the default framebuffer (before swapping):
+	// (starts reading back this frame, if it is being captured, and encodes earlier frames that are ready)
+	void end_frame(glm::uvec2 const &drawable_size);
+
+	//wait for every readback and encode, and free the pixel buffers: (call with the OpenGL context current)
+	void finish();
+
+	//----- internals -----
+	struct Readback {
+		GLuint buffer = 0; //pixel buffer object
+		size_t buffer_size = 0; //(bytes)
+		GLsync fence = 0; //signalled once glReadPixels into 'buffer' is done (0 if the slot is free)
+		glm::uvec2 size = glm::uvec2(0);
+		std::string filename;
+	};
+	std::vector< Readback > ring;
+	std::deque< size_t > in_flight; //ring slots with readbacks pending, oldest first
+
+	std::string pending_screenshot; //(empty if none)
+	bool sequence = false;
+	std::string sequence_prefix;
+	uint32_t sequence_frame = 0;
+
+	uint32_t max_encoding;
+	std::mutex mutex; //guards 'encoding':
+	std::condition_variable encoded; //signalled when an encode finishes
+	uint32_t encoding = 0; //frames handed to the encoders and not yet saved
+	std::unique_ptr< ThreadPool > encoders; //(started on first capture; declared after the state its tasks use)
+
+	void start_readback(glm::uvec2 const &size, std::string const &filename);
+	//if the oldest readback is done (or after waiting for it, if 'wait'), hand it to the encoders and return true:
+	bool collect_oldest(bool wait);
+};
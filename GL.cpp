@@ -1,3 +1,4 @@
+#define GL_TRACE_NO_MACROS
 #include "GL.hpp"
 
 #include <SDL.h>
@@ -584,3 +585,1752 @@ void init_GL() {
 	 void (APIENTRYFP glVertexAttribP4ui) (GLuint index, GLenum type, GLboolean normalized, GLuint value);
 	 void (APIENTRYFP glVertexAttribP4uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 #endif
+
+#ifdef GL_TRACE
+#include <chrono>
+
+GLTraceEntry gl_trace_entries[GLTraceEntries];
+char const *gl_trace_names[GLTraceEntries] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+};
+
+namespace {
+	//counts (and times, until it goes out of scope) one call:
+	struct GLTraceCall {
+		GLTraceCall(GLTraceIndex index, uint64_t bytes = 0) : entry(gl_trace_entries[index]), start(std::chrono::steady_clock::now()) {
+			entry.calls += 1;
+			entry.bytes += bytes;
+		}
+		~GLTraceCall() {
+			entry.nanoseconds += uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+		}
+		GLTraceEntry &entry;
+		std::chrono::steady_clock::time_point start;
+	};
+}
+
+void APIENTRY gl_trace_glCullFace (GLenum mode) {
+	GLTraceCall call(GLTrace_glCullFace);
+	return glCullFace(mode);
+}
+void APIENTRY gl_trace_glFrontFace (GLenum mode) {
+	GLTraceCall call(GLTrace_glFrontFace);
+	return glFrontFace(mode);
+}
+void APIENTRY gl_trace_glHint (GLenum target, GLenum mode) {
+	GLTraceCall call(GLTrace_glHint);
+	return glHint(target, mode);
+}
+void APIENTRY gl_trace_glLineWidth (GLfloat width) {
+	GLTraceCall call(GLTrace_glLineWidth);
+	return glLineWidth(width);
+}
+void APIENTRY gl_trace_glPointSize (GLfloat size) {
+	GLTraceCall call(GLTrace_glPointSize);
+	return glPointSize(size);
+}
+void APIENTRY gl_trace_glPolygonMode (GLenum face, GLenum mode) {
+	GLTraceCall call(GLTrace_glPolygonMode);
+	return glPolygonMode(face, mode);
+}
+void APIENTRY gl_trace_glScissor (GLint x, GLint y, GLsizei width, GLsizei height) {
+	GLTraceCall call(GLTrace_glScissor);
+	return glScissor(x, y, width, height);
+}
+void APIENTRY gl_trace_glTexParameterf (GLenum target, GLenum pname, GLfloat param) {
+	GLTraceCall call(GLTrace_glTexParameterf);
+	return glTexParameterf(target, pname, param);
+}
+void APIENTRY gl_trace_glTexParameterfv (GLenum target, GLenum pname, const GLfloat *params) {
+	GLTraceCall call(GLTrace_glTexParameterfv);
+	return glTexParameterfv(target, pname, params);
+}
+void APIENTRY gl_trace_glTexParameteri (GLenum target, GLenum pname, GLint param) {
+	GLTraceCall call(GLTrace_glTexParameteri);
+	return glTexParameteri(target, pname, param);
+}
+void APIENTRY gl_trace_glTexParameteriv (GLenum target, GLenum pname, const GLint *params) {
+	GLTraceCall call(GLTrace_glTexParameteriv);
+	return glTexParameteriv(target, pname, params);
+}
+void APIENTRY gl_trace_glTexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	GLTraceCall call(GLTrace_glTexImage1D, (pixels ? gl_trace_pixel_bytes(format, type, width, 1, 1) : 0));
+	return glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+void APIENTRY gl_trace_glTexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	GLTraceCall call(GLTrace_glTexImage2D, (pixels ? gl_trace_pixel_bytes(format, type, width, height, 1) : 0));
+	return glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+void APIENTRY gl_trace_glDrawBuffer (GLenum buf) {
+	GLTraceCall call(GLTrace_glDrawBuffer);
+	return glDrawBuffer(buf);
+}
+void APIENTRY gl_trace_glClear (GLbitfield mask) {
+	GLTraceCall call(GLTrace_glClear);
+	return glClear(mask);
+}
+void APIENTRY gl_trace_glClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	GLTraceCall call(GLTrace_glClearColor);
+	return glClearColor(red, green, blue, alpha);
+}
+void APIENTRY gl_trace_glClearStencil (GLint s) {
+	GLTraceCall call(GLTrace_glClearStencil);
+	return glClearStencil(s);
+}
+void APIENTRY gl_trace_glClearDepth (GLdouble depth) {
+	GLTraceCall call(GLTrace_glClearDepth);
+	return glClearDepth(depth);
+}
+void APIENTRY gl_trace_glStencilMask (GLuint mask) {
+	GLTraceCall call(GLTrace_glStencilMask);
+	return glStencilMask(mask);
+}
+void APIENTRY gl_trace_glColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	GLTraceCall call(GLTrace_glColorMask);
+	return glColorMask(red, green, blue, alpha);
+}
+void APIENTRY gl_trace_glDepthMask (GLboolean flag) {
+	GLTraceCall call(GLTrace_glDepthMask);
+	return glDepthMask(flag);
+}
+void APIENTRY gl_trace_glDisable (GLenum cap) {
+	GLTraceCall call(GLTrace_glDisable);
+	return glDisable(cap);
+}
+void APIENTRY gl_trace_glEnable (GLenum cap) {
+	GLTraceCall call(GLTrace_glEnable);
+	return glEnable(cap);
+}
+void APIENTRY gl_trace_glFinish (void) {
+	GLTraceCall call(GLTrace_glFinish);
+	return glFinish();
+}
+void APIENTRY gl_trace_glFlush (void) {
+	GLTraceCall call(GLTrace_glFlush);
+	return glFlush();
+}
+void APIENTRY gl_trace_glBlendFunc (GLenum sfactor, GLenum dfactor) {
+	GLTraceCall call(GLTrace_glBlendFunc);
+	return glBlendFunc(sfactor, dfactor);
+}
+void APIENTRY gl_trace_glLogicOp (GLenum opcode) {
+	GLTraceCall call(GLTrace_glLogicOp);
+	return glLogicOp(opcode);
+}
+void APIENTRY gl_trace_glStencilFunc (GLenum func, GLint ref, GLuint mask) {
+	GLTraceCall call(GLTrace_glStencilFunc);
+	return glStencilFunc(func, ref, mask);
+}
+void APIENTRY gl_trace_glStencilOp (GLenum fail, GLenum zfail, GLenum zpass) {
+	GLTraceCall call(GLTrace_glStencilOp);
+	return glStencilOp(fail, zfail, zpass);
+}
+void APIENTRY gl_trace_glDepthFunc (GLenum func) {
+	GLTraceCall call(GLTrace_glDepthFunc);
+	return glDepthFunc(func);
+}
+void APIENTRY gl_trace_glPixelStoref (GLenum pname, GLfloat param) {
+	GLTraceCall call(GLTrace_glPixelStoref);
+	return glPixelStoref(pname, param);
+}
+void APIENTRY gl_trace_glPixelStorei (GLenum pname, GLint param) {
+	GLTraceCall call(GLTrace_glPixelStorei);
+	return glPixelStorei(pname, param);
+}
+void APIENTRY gl_trace_glReadBuffer (GLenum src) {
+	GLTraceCall call(GLTrace_glReadBuffer);
+	return glReadBuffer(src);
+}
+void APIENTRY gl_trace_glReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	GLTraceCall call(GLTrace_glReadPixels);
+	return glReadPixels(x, y, width, height, format, type, pixels);
+}
+void APIENTRY gl_trace_glGetBooleanv (GLenum pname, GLboolean *data) {
+	GLTraceCall call(GLTrace_glGetBooleanv);
+	return glGetBooleanv(pname, data);
+}
+void APIENTRY gl_trace_glGetDoublev (GLenum pname, GLdouble *data) {
+	GLTraceCall call(GLTrace_glGetDoublev);
+	return glGetDoublev(pname, data);
+}
+GLenum APIENTRY gl_trace_glGetError (void) {
+	GLTraceCall call(GLTrace_glGetError);
+	return glGetError();
+}
+void APIENTRY gl_trace_glGetFloatv (GLenum pname, GLfloat *data) {
+	GLTraceCall call(GLTrace_glGetFloatv);
+	return glGetFloatv(pname, data);
+}
+void APIENTRY gl_trace_glGetIntegerv (GLenum pname, GLint *data) {
+	GLTraceCall call(GLTrace_glGetIntegerv);
+	return glGetIntegerv(pname, data);
+}
+const GLubyte * APIENTRY gl_trace_glGetString (GLenum name) {
+	GLTraceCall call(GLTrace_glGetString);
+	return glGetString(name);
+}
+void APIENTRY gl_trace_glGetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	GLTraceCall call(GLTrace_glGetTexImage);
+	return glGetTexImage(target, level, format, type, pixels);
+}
+void APIENTRY gl_trace_glGetTexParameterfv (GLenum target, GLenum pname, GLfloat *params) {
+	GLTraceCall call(GLTrace_glGetTexParameterfv);
+	return glGetTexParameterfv(target, pname, params);
+}
+void APIENTRY gl_trace_glGetTexParameteriv (GLenum target, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetTexParameteriv);
+	return glGetTexParameteriv(target, pname, params);
+}
+void APIENTRY gl_trace_glGetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	GLTraceCall call(GLTrace_glGetTexLevelParameterfv);
+	return glGetTexLevelParameterfv(target, level, pname, params);
+}
+void APIENTRY gl_trace_glGetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetTexLevelParameteriv);
+	return glGetTexLevelParameteriv(target, level, pname, params);
+}
+GLboolean APIENTRY gl_trace_glIsEnabled (GLenum cap) {
+	GLTraceCall call(GLTrace_glIsEnabled);
+	return glIsEnabled(cap);
+}
+void APIENTRY gl_trace_glDepthRange (GLdouble n, GLdouble f) {
+	GLTraceCall call(GLTrace_glDepthRange);
+	return glDepthRange(n, f);
+}
+void APIENTRY gl_trace_glViewport (GLint x, GLint y, GLsizei width, GLsizei height) {
+	GLTraceCall call(GLTrace_glViewport);
+	return glViewport(x, y, width, height);
+}
+void APIENTRY gl_trace_glDrawArrays (GLenum mode, GLint first, GLsizei count) {
+	GLTraceCall call(GLTrace_glDrawArrays);
+	return glDrawArrays(mode, first, count);
+}
+void APIENTRY gl_trace_glDrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	GLTraceCall call(GLTrace_glDrawElements);
+	return glDrawElements(mode, count, type, indices);
+}
+void APIENTRY gl_trace_glGetPointerv (GLenum pname, void **params) {
+	GLTraceCall call(GLTrace_glGetPointerv);
+	return glGetPointerv(pname, params);
+}
+void APIENTRY gl_trace_glPolygonOffset (GLfloat factor, GLfloat units) {
+	GLTraceCall call(GLTrace_glPolygonOffset);
+	return glPolygonOffset(factor, units);
+}
+void APIENTRY gl_trace_glCopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	GLTraceCall call(GLTrace_glCopyTexImage1D);
+	return glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+void APIENTRY gl_trace_glCopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	GLTraceCall call(GLTrace_glCopyTexImage2D);
+	return glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+void APIENTRY gl_trace_glCopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	GLTraceCall call(GLTrace_glCopyTexSubImage1D);
+	return glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+void APIENTRY gl_trace_glCopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	GLTraceCall call(GLTrace_glCopyTexSubImage2D);
+	return glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+void APIENTRY gl_trace_glTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	GLTraceCall call(GLTrace_glTexSubImage1D, (pixels ? gl_trace_pixel_bytes(format, type, width, 1, 1) : 0));
+	return glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+void APIENTRY gl_trace_glTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	GLTraceCall call(GLTrace_glTexSubImage2D, (pixels ? gl_trace_pixel_bytes(format, type, width, height, 1) : 0));
+	return glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+void APIENTRY gl_trace_glBindTexture (GLenum target, GLuint texture) {
+	GLTraceCall call(GLTrace_glBindTexture);
+	return glBindTexture(target, texture);
+}
+void APIENTRY gl_trace_glDeleteTextures (GLsizei n, const GLuint *textures) {
+	GLTraceCall call(GLTrace_glDeleteTextures);
+	return glDeleteTextures(n, textures);
+}
+void APIENTRY gl_trace_glGenTextures (GLsizei n, GLuint *textures) {
+	GLTraceCall call(GLTrace_glGenTextures);
+	return glGenTextures(n, textures);
+}
+GLboolean APIENTRY gl_trace_glIsTexture (GLuint texture) {
+	GLTraceCall call(GLTrace_glIsTexture);
+	return glIsTexture(texture);
+}
+void APIENTRY gl_trace_glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	GLTraceCall call(GLTrace_glDrawRangeElements);
+	return glDrawRangeElements(mode, start, end, count, type, indices);
+}
+void APIENTRY gl_trace_glTexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	GLTraceCall call(GLTrace_glTexImage3D, (pixels ? gl_trace_pixel_bytes(format, type, width, height, depth) : 0));
+	return glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+void APIENTRY gl_trace_glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	GLTraceCall call(GLTrace_glTexSubImage3D, (pixels ? gl_trace_pixel_bytes(format, type, width, height, depth) : 0));
+	return glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+void APIENTRY gl_trace_glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	GLTraceCall call(GLTrace_glCopyTexSubImage3D);
+	return glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+void APIENTRY gl_trace_glActiveTexture (GLenum texture) {
+	GLTraceCall call(GLTrace_glActiveTexture);
+	return glActiveTexture(texture);
+}
+void APIENTRY gl_trace_glSampleCoverage (GLfloat value, GLboolean invert) {
+	GLTraceCall call(GLTrace_glSampleCoverage);
+	return glSampleCoverage(value, invert);
+}
+void APIENTRY gl_trace_glCompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	GLTraceCall call(GLTrace_glCompressedTexImage3D, (data ? uint64_t(imageSize) : 0));
+	return glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+void APIENTRY gl_trace_glCompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	GLTraceCall call(GLTrace_glCompressedTexImage2D, (data ? uint64_t(imageSize) : 0));
+	return glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+void APIENTRY gl_trace_glCompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	GLTraceCall call(GLTrace_glCompressedTexImage1D, (data ? uint64_t(imageSize) : 0));
+	return glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+void APIENTRY gl_trace_glCompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	GLTraceCall call(GLTrace_glCompressedTexSubImage3D, (data ? uint64_t(imageSize) : 0));
+	return glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+void APIENTRY gl_trace_glCompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	GLTraceCall call(GLTrace_glCompressedTexSubImage2D, (data ? uint64_t(imageSize) : 0));
+	return glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+void APIENTRY gl_trace_glCompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	GLTraceCall call(GLTrace_glCompressedTexSubImage1D, (data ? uint64_t(imageSize) : 0));
+	return glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+void APIENTRY gl_trace_glGetCompressedTexImage (GLenum target, GLint level, void *img) {
+	GLTraceCall call(GLTrace_glGetCompressedTexImage);
+	return glGetCompressedTexImage(target, level, img);
+}
+void APIENTRY gl_trace_glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	GLTraceCall call(GLTrace_glBlendFuncSeparate);
+	return glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+void APIENTRY gl_trace_glMultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	GLTraceCall call(GLTrace_glMultiDrawArrays);
+	return glMultiDrawArrays(mode, first, count, drawcount);
+}
+void APIENTRY gl_trace_glMultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	GLTraceCall call(GLTrace_glMultiDrawElements);
+	return glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+void APIENTRY gl_trace_glPointParameterf (GLenum pname, GLfloat param) {
+	GLTraceCall call(GLTrace_glPointParameterf);
+	return glPointParameterf(pname, param);
+}
+void APIENTRY gl_trace_glPointParameterfv (GLenum pname, const GLfloat *params) {
+	GLTraceCall call(GLTrace_glPointParameterfv);
+	return glPointParameterfv(pname, params);
+}
+void APIENTRY gl_trace_glPointParameteri (GLenum pname, GLint param) {
+	GLTraceCall call(GLTrace_glPointParameteri);
+	return glPointParameteri(pname, param);
+}
+void APIENTRY gl_trace_glPointParameteriv (GLenum pname, const GLint *params) {
+	GLTraceCall call(GLTrace_glPointParameteriv);
+	return glPointParameteriv(pname, params);
+}
+void APIENTRY gl_trace_glBlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	GLTraceCall call(GLTrace_glBlendColor);
+	return glBlendColor(red, green, blue, alpha);
+}
+void APIENTRY gl_trace_glBlendEquation (GLenum mode) {
+	GLTraceCall call(GLTrace_glBlendEquation);
+	return glBlendEquation(mode);
+}
+void APIENTRY gl_trace_glGenQueries (GLsizei n, GLuint *ids) {
+	GLTraceCall call(GLTrace_glGenQueries);
+	return glGenQueries(n, ids);
+}
+void APIENTRY gl_trace_glDeleteQueries (GLsizei n, const GLuint *ids) {
+	GLTraceCall call(GLTrace_glDeleteQueries);
+	return glDeleteQueries(n, ids);
+}
+GLboolean APIENTRY gl_trace_glIsQuery (GLuint id) {
+	GLTraceCall call(GLTrace_glIsQuery);
+	return glIsQuery(id);
+}
+void APIENTRY gl_trace_glBeginQuery (GLenum target, GLuint id) {
+	GLTraceCall call(GLTrace_glBeginQuery);
+	return glBeginQuery(target, id);
+}
+void APIENTRY gl_trace_glEndQuery (GLenum target) {
+	GLTraceCall call(GLTrace_glEndQuery);
+	return glEndQuery(target);
+}
+void APIENTRY gl_trace_glGetQueryiv (GLenum target, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetQueryiv);
+	return glGetQueryiv(target, pname, params);
+}
+void APIENTRY gl_trace_glGetQueryObjectiv (GLuint id, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetQueryObjectiv);
+	return glGetQueryObjectiv(id, pname, params);
+}
+void APIENTRY gl_trace_glGetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params) {
+	GLTraceCall call(GLTrace_glGetQueryObjectuiv);
+	return glGetQueryObjectuiv(id, pname, params);
+}
+void APIENTRY gl_trace_glBindBuffer (GLenum target, GLuint buffer) {
+	GLTraceCall call(GLTrace_glBindBuffer);
+	return glBindBuffer(target, buffer);
+}
+void APIENTRY gl_trace_glDeleteBuffers (GLsizei n, const GLuint *buffers) {
+	GLTraceCall call(GLTrace_glDeleteBuffers);
+	return glDeleteBuffers(n, buffers);
+}
+void APIENTRY gl_trace_glGenBuffers (GLsizei n, GLuint *buffers) {
+	GLTraceCall call(GLTrace_glGenBuffers);
+	return glGenBuffers(n, buffers);
+}
+GLboolean APIENTRY gl_trace_glIsBuffer (GLuint buffer) {
+	GLTraceCall call(GLTrace_glIsBuffer);
+	return glIsBuffer(buffer);
+}
+void APIENTRY gl_trace_glBufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	GLTraceCall call(GLTrace_glBufferData, (data ? uint64_t(size) : 0));
+	return glBufferData(target, size, data, usage);
+}
+void APIENTRY gl_trace_glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	GLTraceCall call(GLTrace_glBufferSubData, uint64_t(size));
+	return glBufferSubData(target, offset, size, data);
+}
+void APIENTRY gl_trace_glGetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	GLTraceCall call(GLTrace_glGetBufferSubData);
+	return glGetBufferSubData(target, offset, size, data);
+}
+void * APIENTRY gl_trace_glMapBuffer (GLenum target, GLenum access) {
+	GLTraceCall call(GLTrace_glMapBuffer);
+	return glMapBuffer(target, access);
+}
+GLboolean APIENTRY gl_trace_glUnmapBuffer (GLenum target) {
+	GLTraceCall call(GLTrace_glUnmapBuffer);
+	return glUnmapBuffer(target);
+}
+void APIENTRY gl_trace_glGetBufferParameteriv (GLenum target, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetBufferParameteriv);
+	return glGetBufferParameteriv(target, pname, params);
+}
+void APIENTRY gl_trace_glGetBufferPointerv (GLenum target, GLenum pname, void **params) {
+	GLTraceCall call(GLTrace_glGetBufferPointerv);
+	return glGetBufferPointerv(target, pname, params);
+}
+void APIENTRY gl_trace_glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha) {
+	GLTraceCall call(GLTrace_glBlendEquationSeparate);
+	return glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+void APIENTRY gl_trace_glDrawBuffers (GLsizei n, const GLenum *bufs) {
+	GLTraceCall call(GLTrace_glDrawBuffers);
+	return glDrawBuffers(n, bufs);
+}
+void APIENTRY gl_trace_glStencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	GLTraceCall call(GLTrace_glStencilOpSeparate);
+	return glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+void APIENTRY gl_trace_glStencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask) {
+	GLTraceCall call(GLTrace_glStencilFuncSeparate);
+	return glStencilFuncSeparate(face, func, ref, mask);
+}
+void APIENTRY gl_trace_glStencilMaskSeparate (GLenum face, GLuint mask) {
+	GLTraceCall call(GLTrace_glStencilMaskSeparate);
+	return glStencilMaskSeparate(face, mask);
+}
+void APIENTRY gl_trace_glAttachShader (GLuint program, GLuint shader) {
+	GLTraceCall call(GLTrace_glAttachShader);
+	return glAttachShader(program, shader);
+}
+void APIENTRY gl_trace_glBindAttribLocation (GLuint program, GLuint index, const GLchar *name) {
+	GLTraceCall call(GLTrace_glBindAttribLocation);
+	return glBindAttribLocation(program, index, name);
+}
+void APIENTRY gl_trace_glCompileShader (GLuint shader) {
+	GLTraceCall call(GLTrace_glCompileShader);
+	return glCompileShader(shader);
+}
+GLuint APIENTRY gl_trace_glCreateProgram (void) {
+	GLTraceCall call(GLTrace_glCreateProgram);
+	return glCreateProgram();
+}
+GLuint APIENTRY gl_trace_glCreateShader (GLenum type) {
+	GLTraceCall call(GLTrace_glCreateShader);
+	return glCreateShader(type);
+}
+void APIENTRY gl_trace_glDeleteProgram (GLuint program) {
+	GLTraceCall call(GLTrace_glDeleteProgram);
+	return glDeleteProgram(program);
+}
+void APIENTRY gl_trace_glDeleteShader (GLuint shader) {
+	GLTraceCall call(GLTrace_glDeleteShader);
+	return glDeleteShader(shader);
+}
+void APIENTRY gl_trace_glDetachShader (GLuint program, GLuint shader) {
+	GLTraceCall call(GLTrace_glDetachShader);
+	return glDetachShader(program, shader);
+}
+void APIENTRY gl_trace_glDisableVertexAttribArray (GLuint index) {
+	GLTraceCall call(GLTrace_glDisableVertexAttribArray);
+	return glDisableVertexAttribArray(index);
+}
+void APIENTRY gl_trace_glEnableVertexAttribArray (GLuint index) {
+	GLTraceCall call(GLTrace_glEnableVertexAttribArray);
+	return glEnableVertexAttribArray(index);
+}
+void APIENTRY gl_trace_glGetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	GLTraceCall call(GLTrace_glGetActiveAttrib);
+	return glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+void APIENTRY gl_trace_glGetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	GLTraceCall call(GLTrace_glGetActiveUniform);
+	return glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+void APIENTRY gl_trace_glGetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	GLTraceCall call(GLTrace_glGetAttachedShaders);
+	return glGetAttachedShaders(program, maxCount, count, shaders);
+}
+GLint APIENTRY gl_trace_glGetAttribLocation (GLuint program, const GLchar *name) {
+	GLTraceCall call(GLTrace_glGetAttribLocation);
+	return glGetAttribLocation(program, name);
+}
+void APIENTRY gl_trace_glGetProgramiv (GLuint program, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetProgramiv);
+	return glGetProgramiv(program, pname, params);
+}
+void APIENTRY gl_trace_glGetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	GLTraceCall call(GLTrace_glGetProgramInfoLog);
+	return glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+void APIENTRY gl_trace_glGetShaderiv (GLuint shader, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetShaderiv);
+	return glGetShaderiv(shader, pname, params);
+}
+void APIENTRY gl_trace_glGetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	GLTraceCall call(GLTrace_glGetShaderInfoLog);
+	return glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+void APIENTRY gl_trace_glGetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	GLTraceCall call(GLTrace_glGetShaderSource);
+	return glGetShaderSource(shader, bufSize, length, source);
+}
+GLint APIENTRY gl_trace_glGetUniformLocation (GLuint program, const GLchar *name) {
+	GLTraceCall call(GLTrace_glGetUniformLocation);
+	return glGetUniformLocation(program, name);
+}
+void APIENTRY gl_trace_glGetUniformfv (GLuint program, GLint location, GLfloat *params) {
+	GLTraceCall call(GLTrace_glGetUniformfv);
+	return glGetUniformfv(program, location, params);
+}
+void APIENTRY gl_trace_glGetUniformiv (GLuint program, GLint location, GLint *params) {
+	GLTraceCall call(GLTrace_glGetUniformiv);
+	return glGetUniformiv(program, location, params);
+}
+void APIENTRY gl_trace_glGetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params) {
+	GLTraceCall call(GLTrace_glGetVertexAttribdv);
+	return glGetVertexAttribdv(index, pname, params);
+}
+void APIENTRY gl_trace_glGetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params) {
+	GLTraceCall call(GLTrace_glGetVertexAttribfv);
+	return glGetVertexAttribfv(index, pname, params);
+}
+void APIENTRY gl_trace_glGetVertexAttribiv (GLuint index, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetVertexAttribiv);
+	return glGetVertexAttribiv(index, pname, params);
+}
+void APIENTRY gl_trace_glGetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer) {
+	GLTraceCall call(GLTrace_glGetVertexAttribPointerv);
+	return glGetVertexAttribPointerv(index, pname, pointer);
+}
+GLboolean APIENTRY gl_trace_glIsProgram (GLuint program) {
+	GLTraceCall call(GLTrace_glIsProgram);
+	return glIsProgram(program);
+}
+GLboolean APIENTRY gl_trace_glIsShader (GLuint shader) {
+	GLTraceCall call(GLTrace_glIsShader);
+	return glIsShader(shader);
+}
+void APIENTRY gl_trace_glLinkProgram (GLuint program) {
+	GLTraceCall call(GLTrace_glLinkProgram);
+	return glLinkProgram(program);
+}
+void APIENTRY gl_trace_glShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	GLTraceCall call(GLTrace_glShaderSource);
+	return glShaderSource(shader, count, string, length);
+}
+void APIENTRY gl_trace_glUseProgram (GLuint program) {
+	GLTraceCall call(GLTrace_glUseProgram);
+	return glUseProgram(program);
+}
+void APIENTRY gl_trace_glUniform1f (GLint location, GLfloat v0) {
+	GLTraceCall call(GLTrace_glUniform1f);
+	return glUniform1f(location, v0);
+}
+void APIENTRY gl_trace_glUniform2f (GLint location, GLfloat v0, GLfloat v1) {
+	GLTraceCall call(GLTrace_glUniform2f);
+	return glUniform2f(location, v0, v1);
+}
+void APIENTRY gl_trace_glUniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	GLTraceCall call(GLTrace_glUniform3f);
+	return glUniform3f(location, v0, v1, v2);
+}
+void APIENTRY gl_trace_glUniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	GLTraceCall call(GLTrace_glUniform4f);
+	return glUniform4f(location, v0, v1, v2, v3);
+}
+void APIENTRY gl_trace_glUniform1i (GLint location, GLint v0) {
+	GLTraceCall call(GLTrace_glUniform1i);
+	return glUniform1i(location, v0);
+}
+void APIENTRY gl_trace_glUniform2i (GLint location, GLint v0, GLint v1) {
+	GLTraceCall call(GLTrace_glUniform2i);
+	return glUniform2i(location, v0, v1);
+}
+void APIENTRY gl_trace_glUniform3i (GLint location, GLint v0, GLint v1, GLint v2) {
+	GLTraceCall call(GLTrace_glUniform3i);
+	return glUniform3i(location, v0, v1, v2);
+}
+void APIENTRY gl_trace_glUniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	GLTraceCall call(GLTrace_glUniform4i);
+	return glUniform4i(location, v0, v1, v2, v3);
+}
+void APIENTRY gl_trace_glUniform1fv (GLint location, GLsizei count, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniform1fv);
+	return glUniform1fv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform2fv (GLint location, GLsizei count, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniform2fv);
+	return glUniform2fv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform3fv (GLint location, GLsizei count, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniform3fv);
+	return glUniform3fv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform4fv (GLint location, GLsizei count, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniform4fv);
+	return glUniform4fv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform1iv (GLint location, GLsizei count, const GLint *value) {
+	GLTraceCall call(GLTrace_glUniform1iv);
+	return glUniform1iv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform2iv (GLint location, GLsizei count, const GLint *value) {
+	GLTraceCall call(GLTrace_glUniform2iv);
+	return glUniform2iv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform3iv (GLint location, GLsizei count, const GLint *value) {
+	GLTraceCall call(GLTrace_glUniform3iv);
+	return glUniform3iv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform4iv (GLint location, GLsizei count, const GLint *value) {
+	GLTraceCall call(GLTrace_glUniform4iv);
+	return glUniform4iv(location, count, value);
+}
+void APIENTRY gl_trace_glUniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix2fv);
+	return glUniformMatrix2fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glUniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix3fv);
+	return glUniformMatrix3fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix4fv);
+	return glUniformMatrix4fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glValidateProgram (GLuint program) {
+	GLTraceCall call(GLTrace_glValidateProgram);
+	return glValidateProgram(program);
+}
+void APIENTRY gl_trace_glVertexAttrib1d (GLuint index, GLdouble x) {
+	GLTraceCall call(GLTrace_glVertexAttrib1d);
+	return glVertexAttrib1d(index, x);
+}
+void APIENTRY gl_trace_glVertexAttrib1dv (GLuint index, const GLdouble *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib1dv);
+	return glVertexAttrib1dv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib1f (GLuint index, GLfloat x) {
+	GLTraceCall call(GLTrace_glVertexAttrib1f);
+	return glVertexAttrib1f(index, x);
+}
+void APIENTRY gl_trace_glVertexAttrib1fv (GLuint index, const GLfloat *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib1fv);
+	return glVertexAttrib1fv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib1s (GLuint index, GLshort x) {
+	GLTraceCall call(GLTrace_glVertexAttrib1s);
+	return glVertexAttrib1s(index, x);
+}
+void APIENTRY gl_trace_glVertexAttrib1sv (GLuint index, const GLshort *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib1sv);
+	return glVertexAttrib1sv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib2d (GLuint index, GLdouble x, GLdouble y) {
+	GLTraceCall call(GLTrace_glVertexAttrib2d);
+	return glVertexAttrib2d(index, x, y);
+}
+void APIENTRY gl_trace_glVertexAttrib2dv (GLuint index, const GLdouble *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib2dv);
+	return glVertexAttrib2dv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib2f (GLuint index, GLfloat x, GLfloat y) {
+	GLTraceCall call(GLTrace_glVertexAttrib2f);
+	return glVertexAttrib2f(index, x, y);
+}
+void APIENTRY gl_trace_glVertexAttrib2fv (GLuint index, const GLfloat *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib2fv);
+	return glVertexAttrib2fv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib2s (GLuint index, GLshort x, GLshort y) {
+	GLTraceCall call(GLTrace_glVertexAttrib2s);
+	return glVertexAttrib2s(index, x, y);
+}
+void APIENTRY gl_trace_glVertexAttrib2sv (GLuint index, const GLshort *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib2sv);
+	return glVertexAttrib2sv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	GLTraceCall call(GLTrace_glVertexAttrib3d);
+	return glVertexAttrib3d(index, x, y, z);
+}
+void APIENTRY gl_trace_glVertexAttrib3dv (GLuint index, const GLdouble *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib3dv);
+	return glVertexAttrib3dv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	GLTraceCall call(GLTrace_glVertexAttrib3f);
+	return glVertexAttrib3f(index, x, y, z);
+}
+void APIENTRY gl_trace_glVertexAttrib3fv (GLuint index, const GLfloat *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib3fv);
+	return glVertexAttrib3fv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z) {
+	GLTraceCall call(GLTrace_glVertexAttrib3s);
+	return glVertexAttrib3s(index, x, y, z);
+}
+void APIENTRY gl_trace_glVertexAttrib3sv (GLuint index, const GLshort *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib3sv);
+	return glVertexAttrib3sv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4Nbv (GLuint index, const GLbyte *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4Nbv);
+	return glVertexAttrib4Nbv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4Niv (GLuint index, const GLint *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4Niv);
+	return glVertexAttrib4Niv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4Nsv (GLuint index, const GLshort *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4Nsv);
+	return glVertexAttrib4Nsv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	GLTraceCall call(GLTrace_glVertexAttrib4Nub);
+	return glVertexAttrib4Nub(index, x, y, z, w);
+}
+void APIENTRY gl_trace_glVertexAttrib4Nubv (GLuint index, const GLubyte *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4Nubv);
+	return glVertexAttrib4Nubv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4Nuiv (GLuint index, const GLuint *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4Nuiv);
+	return glVertexAttrib4Nuiv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4Nusv (GLuint index, const GLushort *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4Nusv);
+	return glVertexAttrib4Nusv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4bv (GLuint index, const GLbyte *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4bv);
+	return glVertexAttrib4bv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	GLTraceCall call(GLTrace_glVertexAttrib4d);
+	return glVertexAttrib4d(index, x, y, z, w);
+}
+void APIENTRY gl_trace_glVertexAttrib4dv (GLuint index, const GLdouble *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4dv);
+	return glVertexAttrib4dv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	GLTraceCall call(GLTrace_glVertexAttrib4f);
+	return glVertexAttrib4f(index, x, y, z, w);
+}
+void APIENTRY gl_trace_glVertexAttrib4fv (GLuint index, const GLfloat *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4fv);
+	return glVertexAttrib4fv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4iv (GLuint index, const GLint *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4iv);
+	return glVertexAttrib4iv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	GLTraceCall call(GLTrace_glVertexAttrib4s);
+	return glVertexAttrib4s(index, x, y, z, w);
+}
+void APIENTRY gl_trace_glVertexAttrib4sv (GLuint index, const GLshort *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4sv);
+	return glVertexAttrib4sv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4ubv (GLuint index, const GLubyte *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4ubv);
+	return glVertexAttrib4ubv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4uiv (GLuint index, const GLuint *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4uiv);
+	return glVertexAttrib4uiv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttrib4usv (GLuint index, const GLushort *v) {
+	GLTraceCall call(GLTrace_glVertexAttrib4usv);
+	return glVertexAttrib4usv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	GLTraceCall call(GLTrace_glVertexAttribPointer);
+	return glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+void APIENTRY gl_trace_glUniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix2x3fv);
+	return glUniformMatrix2x3fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glUniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix3x2fv);
+	return glUniformMatrix3x2fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glUniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix2x4fv);
+	return glUniformMatrix2x4fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glUniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix4x2fv);
+	return glUniformMatrix4x2fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glUniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix3x4fv);
+	return glUniformMatrix3x4fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glUniformMatrix4x3fv);
+	return glUniformMatrix4x3fv(location, count, transpose, value);
+}
+void APIENTRY gl_trace_glColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	GLTraceCall call(GLTrace_glColorMaski);
+	return glColorMaski(index, r, g, b, a);
+}
+void APIENTRY gl_trace_glGetBooleani_v (GLenum target, GLuint index, GLboolean *data) {
+	GLTraceCall call(GLTrace_glGetBooleani_v);
+	return glGetBooleani_v(target, index, data);
+}
+void APIENTRY gl_trace_glGetIntegeri_v (GLenum target, GLuint index, GLint *data) {
+	GLTraceCall call(GLTrace_glGetIntegeri_v);
+	return glGetIntegeri_v(target, index, data);
+}
+void APIENTRY gl_trace_glEnablei (GLenum target, GLuint index) {
+	GLTraceCall call(GLTrace_glEnablei);
+	return glEnablei(target, index);
+}
+void APIENTRY gl_trace_glDisablei (GLenum target, GLuint index) {
+	GLTraceCall call(GLTrace_glDisablei);
+	return glDisablei(target, index);
+}
+GLboolean APIENTRY gl_trace_glIsEnabledi (GLenum target, GLuint index) {
+	GLTraceCall call(GLTrace_glIsEnabledi);
+	return glIsEnabledi(target, index);
+}
+void APIENTRY gl_trace_glBeginTransformFeedback (GLenum primitiveMode) {
+	GLTraceCall call(GLTrace_glBeginTransformFeedback);
+	return glBeginTransformFeedback(primitiveMode);
+}
+void APIENTRY gl_trace_glEndTransformFeedback (void) {
+	GLTraceCall call(GLTrace_glEndTransformFeedback);
+	return glEndTransformFeedback();
+}
+void APIENTRY gl_trace_glBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	GLTraceCall call(GLTrace_glBindBufferRange);
+	return glBindBufferRange(target, index, buffer, offset, size);
+}
+void APIENTRY gl_trace_glBindBufferBase (GLenum target, GLuint index, GLuint buffer) {
+	GLTraceCall call(GLTrace_glBindBufferBase);
+	return glBindBufferBase(target, index, buffer);
+}
+void APIENTRY gl_trace_glTransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	GLTraceCall call(GLTrace_glTransformFeedbackVaryings);
+	return glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+void APIENTRY gl_trace_glGetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	GLTraceCall call(GLTrace_glGetTransformFeedbackVarying);
+	return glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+void APIENTRY gl_trace_glClampColor (GLenum target, GLenum clamp) {
+	GLTraceCall call(GLTrace_glClampColor);
+	return glClampColor(target, clamp);
+}
+void APIENTRY gl_trace_glBeginConditionalRender (GLuint id, GLenum mode) {
+	GLTraceCall call(GLTrace_glBeginConditionalRender);
+	return glBeginConditionalRender(id, mode);
+}
+void APIENTRY gl_trace_glEndConditionalRender (void) {
+	GLTraceCall call(GLTrace_glEndConditionalRender);
+	return glEndConditionalRender();
+}
+void APIENTRY gl_trace_glVertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	GLTraceCall call(GLTrace_glVertexAttribIPointer);
+	return glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+void APIENTRY gl_trace_glGetVertexAttribIiv (GLuint index, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetVertexAttribIiv);
+	return glGetVertexAttribIiv(index, pname, params);
+}
+void APIENTRY gl_trace_glGetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params) {
+	GLTraceCall call(GLTrace_glGetVertexAttribIuiv);
+	return glGetVertexAttribIuiv(index, pname, params);
+}
+void APIENTRY gl_trace_glVertexAttribI1i (GLuint index, GLint x) {
+	GLTraceCall call(GLTrace_glVertexAttribI1i);
+	return glVertexAttribI1i(index, x);
+}
+void APIENTRY gl_trace_glVertexAttribI2i (GLuint index, GLint x, GLint y) {
+	GLTraceCall call(GLTrace_glVertexAttribI2i);
+	return glVertexAttribI2i(index, x, y);
+}
+void APIENTRY gl_trace_glVertexAttribI3i (GLuint index, GLint x, GLint y, GLint z) {
+	GLTraceCall call(GLTrace_glVertexAttribI3i);
+	return glVertexAttribI3i(index, x, y, z);
+}
+void APIENTRY gl_trace_glVertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	GLTraceCall call(GLTrace_glVertexAttribI4i);
+	return glVertexAttribI4i(index, x, y, z, w);
+}
+void APIENTRY gl_trace_glVertexAttribI1ui (GLuint index, GLuint x) {
+	GLTraceCall call(GLTrace_glVertexAttribI1ui);
+	return glVertexAttribI1ui(index, x);
+}
+void APIENTRY gl_trace_glVertexAttribI2ui (GLuint index, GLuint x, GLuint y) {
+	GLTraceCall call(GLTrace_glVertexAttribI2ui);
+	return glVertexAttribI2ui(index, x, y);
+}
+void APIENTRY gl_trace_glVertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z) {
+	GLTraceCall call(GLTrace_glVertexAttribI3ui);
+	return glVertexAttribI3ui(index, x, y, z);
+}
+void APIENTRY gl_trace_glVertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	GLTraceCall call(GLTrace_glVertexAttribI4ui);
+	return glVertexAttribI4ui(index, x, y, z, w);
+}
+void APIENTRY gl_trace_glVertexAttribI1iv (GLuint index, const GLint *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI1iv);
+	return glVertexAttribI1iv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI2iv (GLuint index, const GLint *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI2iv);
+	return glVertexAttribI2iv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI3iv (GLuint index, const GLint *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI3iv);
+	return glVertexAttribI3iv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI4iv (GLuint index, const GLint *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI4iv);
+	return glVertexAttribI4iv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI1uiv (GLuint index, const GLuint *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI1uiv);
+	return glVertexAttribI1uiv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI2uiv (GLuint index, const GLuint *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI2uiv);
+	return glVertexAttribI2uiv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI3uiv (GLuint index, const GLuint *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI3uiv);
+	return glVertexAttribI3uiv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI4uiv (GLuint index, const GLuint *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI4uiv);
+	return glVertexAttribI4uiv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI4bv (GLuint index, const GLbyte *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI4bv);
+	return glVertexAttribI4bv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI4sv (GLuint index, const GLshort *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI4sv);
+	return glVertexAttribI4sv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI4ubv (GLuint index, const GLubyte *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI4ubv);
+	return glVertexAttribI4ubv(index, v);
+}
+void APIENTRY gl_trace_glVertexAttribI4usv (GLuint index, const GLushort *v) {
+	GLTraceCall call(GLTrace_glVertexAttribI4usv);
+	return glVertexAttribI4usv(index, v);
+}
+void APIENTRY gl_trace_glGetUniformuiv (GLuint program, GLint location, GLuint *params) {
+	GLTraceCall call(GLTrace_glGetUniformuiv);
+	return glGetUniformuiv(program, location, params);
+}
+void APIENTRY gl_trace_glBindFragDataLocation (GLuint program, GLuint color, const GLchar *name) {
+	GLTraceCall call(GLTrace_glBindFragDataLocation);
+	return glBindFragDataLocation(program, color, name);
+}
+GLint APIENTRY gl_trace_glGetFragDataLocation (GLuint program, const GLchar *name) {
+	GLTraceCall call(GLTrace_glGetFragDataLocation);
+	return glGetFragDataLocation(program, name);
+}
+void APIENTRY gl_trace_glUniform1ui (GLint location, GLuint v0) {
+	GLTraceCall call(GLTrace_glUniform1ui);
+	return glUniform1ui(location, v0);
+}
+void APIENTRY gl_trace_glUniform2ui (GLint location, GLuint v0, GLuint v1) {
+	GLTraceCall call(GLTrace_glUniform2ui);
+	return glUniform2ui(location, v0, v1);
+}
+void APIENTRY gl_trace_glUniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	GLTraceCall call(GLTrace_glUniform3ui);
+	return glUniform3ui(location, v0, v1, v2);
+}
+void APIENTRY gl_trace_glUniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	GLTraceCall call(GLTrace_glUniform4ui);
+	return glUniform4ui(location, v0, v1, v2, v3);
+}
+void APIENTRY gl_trace_glUniform1uiv (GLint location, GLsizei count, const GLuint *value) {
+	GLTraceCall call(GLTrace_glUniform1uiv);
+	return glUniform1uiv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform2uiv (GLint location, GLsizei count, const GLuint *value) {
+	GLTraceCall call(GLTrace_glUniform2uiv);
+	return glUniform2uiv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform3uiv (GLint location, GLsizei count, const GLuint *value) {
+	GLTraceCall call(GLTrace_glUniform3uiv);
+	return glUniform3uiv(location, count, value);
+}
+void APIENTRY gl_trace_glUniform4uiv (GLint location, GLsizei count, const GLuint *value) {
+	GLTraceCall call(GLTrace_glUniform4uiv);
+	return glUniform4uiv(location, count, value);
+}
+void APIENTRY gl_trace_glTexParameterIiv (GLenum target, GLenum pname, const GLint *params) {
+	GLTraceCall call(GLTrace_glTexParameterIiv);
+	return glTexParameterIiv(target, pname, params);
+}
+void APIENTRY gl_trace_glTexParameterIuiv (GLenum target, GLenum pname, const GLuint *params) {
+	GLTraceCall call(GLTrace_glTexParameterIuiv);
+	return glTexParameterIuiv(target, pname, params);
+}
+void APIENTRY gl_trace_glGetTexParameterIiv (GLenum target, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetTexParameterIiv);
+	return glGetTexParameterIiv(target, pname, params);
+}
+void APIENTRY gl_trace_glGetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params) {
+	GLTraceCall call(GLTrace_glGetTexParameterIuiv);
+	return glGetTexParameterIuiv(target, pname, params);
+}
+void APIENTRY gl_trace_glClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value) {
+	GLTraceCall call(GLTrace_glClearBufferiv);
+	return glClearBufferiv(buffer, drawbuffer, value);
+}
+void APIENTRY gl_trace_glClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	GLTraceCall call(GLTrace_glClearBufferuiv);
+	return glClearBufferuiv(buffer, drawbuffer, value);
+}
+void APIENTRY gl_trace_glClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	GLTraceCall call(GLTrace_glClearBufferfv);
+	return glClearBufferfv(buffer, drawbuffer, value);
+}
+void APIENTRY gl_trace_glClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	GLTraceCall call(GLTrace_glClearBufferfi);
+	return glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+const GLubyte * APIENTRY gl_trace_glGetStringi (GLenum name, GLuint index) {
+	GLTraceCall call(GLTrace_glGetStringi);
+	return glGetStringi(name, index);
+}
+GLboolean APIENTRY gl_trace_glIsRenderbuffer (GLuint renderbuffer) {
+	GLTraceCall call(GLTrace_glIsRenderbuffer);
+	return glIsRenderbuffer(renderbuffer);
+}
+void APIENTRY gl_trace_glBindRenderbuffer (GLenum target, GLuint renderbuffer) {
+	GLTraceCall call(GLTrace_glBindRenderbuffer);
+	return glBindRenderbuffer(target, renderbuffer);
+}
+void APIENTRY gl_trace_glDeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers) {
+	GLTraceCall call(GLTrace_glDeleteRenderbuffers);
+	return glDeleteRenderbuffers(n, renderbuffers);
+}
+void APIENTRY gl_trace_glGenRenderbuffers (GLsizei n, GLuint *renderbuffers) {
+	GLTraceCall call(GLTrace_glGenRenderbuffers);
+	return glGenRenderbuffers(n, renderbuffers);
+}
+void APIENTRY gl_trace_glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	GLTraceCall call(GLTrace_glRenderbufferStorage);
+	return glRenderbufferStorage(target, internalformat, width, height);
+}
+void APIENTRY gl_trace_glGetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetRenderbufferParameteriv);
+	return glGetRenderbufferParameteriv(target, pname, params);
+}
+GLboolean APIENTRY gl_trace_glIsFramebuffer (GLuint framebuffer) {
+	GLTraceCall call(GLTrace_glIsFramebuffer);
+	return glIsFramebuffer(framebuffer);
+}
+void APIENTRY gl_trace_glBindFramebuffer (GLenum target, GLuint framebuffer) {
+	GLTraceCall call(GLTrace_glBindFramebuffer);
+	return glBindFramebuffer(target, framebuffer);
+}
+void APIENTRY gl_trace_glDeleteFramebuffers (GLsizei n, const GLuint *framebuffers) {
+	GLTraceCall call(GLTrace_glDeleteFramebuffers);
+	return glDeleteFramebuffers(n, framebuffers);
+}
+void APIENTRY gl_trace_glGenFramebuffers (GLsizei n, GLuint *framebuffers) {
+	GLTraceCall call(GLTrace_glGenFramebuffers);
+	return glGenFramebuffers(n, framebuffers);
+}
+GLenum APIENTRY gl_trace_glCheckFramebufferStatus (GLenum target) {
+	GLTraceCall call(GLTrace_glCheckFramebufferStatus);
+	return glCheckFramebufferStatus(target);
+}
+void APIENTRY gl_trace_glFramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	GLTraceCall call(GLTrace_glFramebufferTexture1D);
+	return glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+void APIENTRY gl_trace_glFramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	GLTraceCall call(GLTrace_glFramebufferTexture2D);
+	return glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+void APIENTRY gl_trace_glFramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	GLTraceCall call(GLTrace_glFramebufferTexture3D);
+	return glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+void APIENTRY gl_trace_glFramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	GLTraceCall call(GLTrace_glFramebufferRenderbuffer);
+	return glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+void APIENTRY gl_trace_glGetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetFramebufferAttachmentParameteriv);
+	return glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+void APIENTRY gl_trace_glGenerateMipmap (GLenum target) {
+	GLTraceCall call(GLTrace_glGenerateMipmap);
+	return glGenerateMipmap(target);
+}
+void APIENTRY gl_trace_glBlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	GLTraceCall call(GLTrace_glBlitFramebuffer);
+	return glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+void APIENTRY gl_trace_glRenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	GLTraceCall call(GLTrace_glRenderbufferStorageMultisample);
+	return glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+void APIENTRY gl_trace_glFramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	GLTraceCall call(GLTrace_glFramebufferTextureLayer);
+	return glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+void * APIENTRY gl_trace_glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	GLTraceCall call(GLTrace_glMapBufferRange);
+	return glMapBufferRange(target, offset, length, access);
+}
+void APIENTRY gl_trace_glFlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length) {
+	GLTraceCall call(GLTrace_glFlushMappedBufferRange);
+	return glFlushMappedBufferRange(target, offset, length);
+}
+void APIENTRY gl_trace_glBindVertexArray (GLuint array) {
+	GLTraceCall call(GLTrace_glBindVertexArray);
+	return glBindVertexArray(array);
+}
+void APIENTRY gl_trace_glDeleteVertexArrays (GLsizei n, const GLuint *arrays) {
+	GLTraceCall call(GLTrace_glDeleteVertexArrays);
+	return glDeleteVertexArrays(n, arrays);
+}
+void APIENTRY gl_trace_glGenVertexArrays (GLsizei n, GLuint *arrays) {
+	GLTraceCall call(GLTrace_glGenVertexArrays);
+	return glGenVertexArrays(n, arrays);
+}
+GLboolean APIENTRY gl_trace_glIsVertexArray (GLuint array) {
+	GLTraceCall call(GLTrace_glIsVertexArray);
+	return glIsVertexArray(array);
+}
+void APIENTRY gl_trace_glDrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	GLTraceCall call(GLTrace_glDrawArraysInstanced);
+	return glDrawArraysInstanced(mode, first, count, instancecount);
+}
+void APIENTRY gl_trace_glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	GLTraceCall call(GLTrace_glDrawElementsInstanced);
+	return glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+void APIENTRY gl_trace_glTexBuffer (GLenum target, GLenum internalformat, GLuint buffer) {
+	GLTraceCall call(GLTrace_glTexBuffer);
+	return glTexBuffer(target, internalformat, buffer);
+}
+void APIENTRY gl_trace_glPrimitiveRestartIndex (GLuint index) {
+	GLTraceCall call(GLTrace_glPrimitiveRestartIndex);
+	return glPrimitiveRestartIndex(index);
+}
+void APIENTRY gl_trace_glCopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	GLTraceCall call(GLTrace_glCopyBufferSubData);
+	return glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+void APIENTRY gl_trace_glGetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	GLTraceCall call(GLTrace_glGetUniformIndices);
+	return glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+void APIENTRY gl_trace_glGetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetActiveUniformsiv);
+	return glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+void APIENTRY gl_trace_glGetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	GLTraceCall call(GLTrace_glGetActiveUniformName);
+	return glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+GLuint APIENTRY gl_trace_glGetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName) {
+	GLTraceCall call(GLTrace_glGetUniformBlockIndex);
+	return glGetUniformBlockIndex(program, uniformBlockName);
+}
+void APIENTRY gl_trace_glGetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetActiveUniformBlockiv);
+	return glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+void APIENTRY gl_trace_glGetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	GLTraceCall call(GLTrace_glGetActiveUniformBlockName);
+	return glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+void APIENTRY gl_trace_glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	GLTraceCall call(GLTrace_glUniformBlockBinding);
+	return glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+void APIENTRY gl_trace_glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	GLTraceCall call(GLTrace_glDrawElementsBaseVertex);
+	return glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+void APIENTRY gl_trace_glDrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	GLTraceCall call(GLTrace_glDrawRangeElementsBaseVertex);
+	return glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+void APIENTRY gl_trace_glDrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	GLTraceCall call(GLTrace_glDrawElementsInstancedBaseVertex);
+	return glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+void APIENTRY gl_trace_glMultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	GLTraceCall call(GLTrace_glMultiDrawElementsBaseVertex);
+	return glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+void APIENTRY gl_trace_glProvokingVertex (GLenum mode) {
+	GLTraceCall call(GLTrace_glProvokingVertex);
+	return glProvokingVertex(mode);
+}
+GLsync APIENTRY gl_trace_glFenceSync (GLenum condition, GLbitfield flags) {
+	GLTraceCall call(GLTrace_glFenceSync);
+	return glFenceSync(condition, flags);
+}
+GLboolean APIENTRY gl_trace_glIsSync (GLsync sync) {
+	GLTraceCall call(GLTrace_glIsSync);
+	return glIsSync(sync);
+}
+void APIENTRY gl_trace_glDeleteSync (GLsync sync) {
+	GLTraceCall call(GLTrace_glDeleteSync);
+	return glDeleteSync(sync);
+}
+GLenum APIENTRY gl_trace_glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLTraceCall call(GLTrace_glClientWaitSync);
+	return glClientWaitSync(sync, flags, timeout);
+}
+void APIENTRY gl_trace_glWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLTraceCall call(GLTrace_glWaitSync);
+	return glWaitSync(sync, flags, timeout);
+}
+void APIENTRY gl_trace_glGetInteger64v (GLenum pname, GLint64 *data) {
+	GLTraceCall call(GLTrace_glGetInteger64v);
+	return glGetInteger64v(pname, data);
+}
+void APIENTRY gl_trace_glGetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+	GLTraceCall call(GLTrace_glGetSynciv);
+	return glGetSynciv(sync, pname, bufSize, length, values);
+}
+void APIENTRY gl_trace_glGetInteger64i_v (GLenum target, GLuint index, GLint64 *data) {
+	GLTraceCall call(GLTrace_glGetInteger64i_v);
+	return glGetInteger64i_v(target, index, data);
+}
+void APIENTRY gl_trace_glGetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params) {
+	GLTraceCall call(GLTrace_glGetBufferParameteri64v);
+	return glGetBufferParameteri64v(target, pname, params);
+}
+void APIENTRY gl_trace_glFramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	GLTraceCall call(GLTrace_glFramebufferTexture);
+	return glFramebufferTexture(target, attachment, texture, level);
+}
+void APIENTRY gl_trace_glTexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	GLTraceCall call(GLTrace_glTexImage2DMultisample);
+	return glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+void APIENTRY gl_trace_glTexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	GLTraceCall call(GLTrace_glTexImage3DMultisample);
+	return glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+void APIENTRY gl_trace_glGetMultisamplefv (GLenum pname, GLuint index, GLfloat *val) {
+	GLTraceCall call(GLTrace_glGetMultisamplefv);
+	return glGetMultisamplefv(pname, index, val);
+}
+void APIENTRY gl_trace_glSampleMaski (GLuint maskNumber, GLbitfield mask) {
+	GLTraceCall call(GLTrace_glSampleMaski);
+	return glSampleMaski(maskNumber, mask);
+}
+void APIENTRY gl_trace_glBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	GLTraceCall call(GLTrace_glBindFragDataLocationIndexed);
+	return glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+GLint APIENTRY gl_trace_glGetFragDataIndex (GLuint program, const GLchar *name) {
+	GLTraceCall call(GLTrace_glGetFragDataIndex);
+	return glGetFragDataIndex(program, name);
+}
+void APIENTRY gl_trace_glGenSamplers (GLsizei count, GLuint *samplers) {
+	GLTraceCall call(GLTrace_glGenSamplers);
+	return glGenSamplers(count, samplers);
+}
+void APIENTRY gl_trace_glDeleteSamplers (GLsizei count, const GLuint *samplers) {
+	GLTraceCall call(GLTrace_glDeleteSamplers);
+	return glDeleteSamplers(count, samplers);
+}
+GLboolean APIENTRY gl_trace_glIsSampler (GLuint sampler) {
+	GLTraceCall call(GLTrace_glIsSampler);
+	return glIsSampler(sampler);
+}
+void APIENTRY gl_trace_glBindSampler (GLuint unit, GLuint sampler) {
+	GLTraceCall call(GLTrace_glBindSampler);
+	return glBindSampler(unit, sampler);
+}
+void APIENTRY gl_trace_glSamplerParameteri (GLuint sampler, GLenum pname, GLint param) {
+	GLTraceCall call(GLTrace_glSamplerParameteri);
+	return glSamplerParameteri(sampler, pname, param);
+}
+void APIENTRY gl_trace_glSamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param) {
+	GLTraceCall call(GLTrace_glSamplerParameteriv);
+	return glSamplerParameteriv(sampler, pname, param);
+}
+void APIENTRY gl_trace_glSamplerParameterf (GLuint sampler, GLenum pname, GLfloat param) {
+	GLTraceCall call(GLTrace_glSamplerParameterf);
+	return glSamplerParameterf(sampler, pname, param);
+}
+void APIENTRY gl_trace_glSamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param) {
+	GLTraceCall call(GLTrace_glSamplerParameterfv);
+	return glSamplerParameterfv(sampler, pname, param);
+}
+void APIENTRY gl_trace_glSamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param) {
+	GLTraceCall call(GLTrace_glSamplerParameterIiv);
+	return glSamplerParameterIiv(sampler, pname, param);
+}
+void APIENTRY gl_trace_glSamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param) {
+	GLTraceCall call(GLTrace_glSamplerParameterIuiv);
+	return glSamplerParameterIuiv(sampler, pname, param);
+}
+void APIENTRY gl_trace_glGetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetSamplerParameteriv);
+	return glGetSamplerParameteriv(sampler, pname, params);
+}
+void APIENTRY gl_trace_glGetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params) {
+	GLTraceCall call(GLTrace_glGetSamplerParameterIiv);
+	return glGetSamplerParameterIiv(sampler, pname, params);
+}
+void APIENTRY gl_trace_glGetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params) {
+	GLTraceCall call(GLTrace_glGetSamplerParameterfv);
+	return glGetSamplerParameterfv(sampler, pname, params);
+}
+void APIENTRY gl_trace_glGetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params) {
+	GLTraceCall call(GLTrace_glGetSamplerParameterIuiv);
+	return glGetSamplerParameterIuiv(sampler, pname, params);
+}
+void APIENTRY gl_trace_glQueryCounter (GLuint id, GLenum target) {
+	GLTraceCall call(GLTrace_glQueryCounter);
+	return glQueryCounter(id, target);
+}
+void APIENTRY gl_trace_glGetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params) {
+	GLTraceCall call(GLTrace_glGetQueryObjecti64v);
+	return glGetQueryObjecti64v(id, pname, params);
+}
+void APIENTRY gl_trace_glGetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params) {
+	GLTraceCall call(GLTrace_glGetQueryObjectui64v);
+	return glGetQueryObjectui64v(id, pname, params);
+}
+void APIENTRY gl_trace_glVertexAttribDivisor (GLuint index, GLuint divisor) {
+	GLTraceCall call(GLTrace_glVertexAttribDivisor);
+	return glVertexAttribDivisor(index, divisor);
+}
+void APIENTRY gl_trace_glVertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	GLTraceCall call(GLTrace_glVertexAttribP1ui);
+	return glVertexAttribP1ui(index, type, normalized, value);
+}
+void APIENTRY gl_trace_glVertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	GLTraceCall call(GLTrace_glVertexAttribP1uiv);
+	return glVertexAttribP1uiv(index, type, normalized, value);
+}
+void APIENTRY gl_trace_glVertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	GLTraceCall call(GLTrace_glVertexAttribP2ui);
+	return glVertexAttribP2ui(index, type, normalized, value);
+}
+void APIENTRY gl_trace_glVertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	GLTraceCall call(GLTrace_glVertexAttribP2uiv);
+	return glVertexAttribP2uiv(index, type, normalized, value);
+}
+void APIENTRY gl_trace_glVertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	GLTraceCall call(GLTrace_glVertexAttribP3ui);
+	return glVertexAttribP3ui(index, type, normalized, value);
+}
+void APIENTRY gl_trace_glVertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	GLTraceCall call(GLTrace_glVertexAttribP3uiv);
+	return glVertexAttribP3uiv(index, type, normalized, value);
+}
+void APIENTRY gl_trace_glVertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	GLTraceCall call(GLTrace_glVertexAttribP4ui);
+	return glVertexAttribP4ui(index, type, normalized, value);
+}
+void APIENTRY gl_trace_glVertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	GLTraceCall call(GLTrace_glVertexAttribP4uiv);
+	return glVertexAttribP4uiv(index, type, normalized, value);
+}
+#endif //GL_TRACE
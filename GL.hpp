@@ -1277,3 +1277,1068 @@ GLAPI void (APIENTRYFP glVertexAttribP4ui) (GLuint index, GLenum type, GLboolean
 GLAPI void (APIENTRYFP glVertexAttribP4uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 
 }
+
+#ifdef GL_TRACE
+//------ call tracing ------
+//When built with GL_TRACE defined ('jam -sGL_TRACE=1'), every gl* call above goes through a wrapper
+// that counts and times it, and tallies the bytes passed to upload calls; gl_trace.hpp reports them.
+//Without GL_TRACE, none of this exists (and calls go straight to OpenGL).
+
+struct GLTraceEntry {
+	uint32_t calls;
+	uint64_t nanoseconds;
+	uint64_t bytes; //(upload calls only)
+};
+
+enum GLTraceIndex : uint32_t {
+	GLTrace_glCullFace,
+	GLTrace_glFrontFace,
+	GLTrace_glHint,
+	GLTrace_glLineWidth,
+	GLTrace_glPointSize,
+	GLTrace_glPolygonMode,
+	GLTrace_glScissor,
+	GLTrace_glTexParameterf,
+	GLTrace_glTexParameterfv,
+	GLTrace_glTexParameteri,
+	GLTrace_glTexParameteriv,
+	GLTrace_glTexImage1D,
+	GLTrace_glTexImage2D,
+	GLTrace_glDrawBuffer,
+	GLTrace_glClear,
+	GLTrace_glClearColor,
+	GLTrace_glClearStencil,
+	GLTrace_glClearDepth,
+	GLTrace_glStencilMask,
+	GLTrace_glColorMask,
+	GLTrace_glDepthMask,
+	GLTrace_glDisable,
+	GLTrace_glEnable,
+	GLTrace_glFinish,
+	GLTrace_glFlush,
+	GLTrace_glBlendFunc,
+	GLTrace_glLogicOp,
+	GLTrace_glStencilFunc,
+	GLTrace_glStencilOp,
+	GLTrace_glDepthFunc,
+	GLTrace_glPixelStoref,
+	GLTrace_glPixelStorei,
+	GLTrace_glReadBuffer,
+	GLTrace_glReadPixels,
+	GLTrace_glGetBooleanv,
+	GLTrace_glGetDoublev,
+	GLTrace_glGetError,
+	GLTrace_glGetFloatv,
+	GLTrace_glGetIntegerv,
+	GLTrace_glGetString,
+	GLTrace_glGetTexImage,
+	GLTrace_glGetTexParameterfv,
+	GLTrace_glGetTexParameteriv,
+	GLTrace_glGetTexLevelParameterfv,
+	GLTrace_glGetTexLevelParameteriv,
+	GLTrace_glIsEnabled,
+	GLTrace_glDepthRange,
+	GLTrace_glViewport,
+	GLTrace_glDrawArrays,
+	GLTrace_glDrawElements,
+	GLTrace_glGetPointerv,
+	GLTrace_glPolygonOffset,
+	GLTrace_glCopyTexImage1D,
+	GLTrace_glCopyTexImage2D,
+	GLTrace_glCopyTexSubImage1D,
+	GLTrace_glCopyTexSubImage2D,
+	GLTrace_glTexSubImage1D,
+	GLTrace_glTexSubImage2D,
+	GLTrace_glBindTexture,
+	GLTrace_glDeleteTextures,
+	GLTrace_glGenTextures,
+	GLTrace_glIsTexture,
+	GLTrace_glDrawRangeElements,
+	GLTrace_glTexImage3D,
+	GLTrace_glTexSubImage3D,
+	GLTrace_glCopyTexSubImage3D,
+	GLTrace_glActiveTexture,
+	GLTrace_glSampleCoverage,
+	GLTrace_glCompressedTexImage3D,
+	GLTrace_glCompressedTexImage2D,
+	GLTrace_glCompressedTexImage1D,
+	GLTrace_glCompressedTexSubImage3D,
+	GLTrace_glCompressedTexSubImage2D,
+	GLTrace_glCompressedTexSubImage1D,
+	GLTrace_glGetCompressedTexImage,
+	GLTrace_glBlendFuncSeparate,
+	GLTrace_glMultiDrawArrays,
+	GLTrace_glMultiDrawElements,
+	GLTrace_glPointParameterf,
+	GLTrace_glPointParameterfv,
+	GLTrace_glPointParameteri,
+	GLTrace_glPointParameteriv,
+	GLTrace_glBlendColor,
+	GLTrace_glBlendEquation,
+	GLTrace_glGenQueries,
+	GLTrace_glDeleteQueries,
+	GLTrace_glIsQuery,
+	GLTrace_glBeginQuery,
+	GLTrace_glEndQuery,
+	GLTrace_glGetQueryiv,
+	GLTrace_glGetQueryObjectiv,
+	GLTrace_glGetQueryObjectuiv,
+	GLTrace_glBindBuffer,
+	GLTrace_glDeleteBuffers,
+	GLTrace_glGenBuffers,
+	GLTrace_glIsBuffer,
+	GLTrace_glBufferData,
+	GLTrace_glBufferSubData,
+	GLTrace_glGetBufferSubData,
+	GLTrace_glMapBuffer,
+	GLTrace_glUnmapBuffer,
+	GLTrace_glGetBufferParameteriv,
+	GLTrace_glGetBufferPointerv,
+	GLTrace_glBlendEquationSeparate,
+	GLTrace_glDrawBuffers,
+	GLTrace_glStencilOpSeparate,
+	GLTrace_glStencilFuncSeparate,
+	GLTrace_glStencilMaskSeparate,
+	GLTrace_glAttachShader,
+	GLTrace_glBindAttribLocation,
+	GLTrace_glCompileShader,
+	GLTrace_glCreateProgram,
+	GLTrace_glCreateShader,
+	GLTrace_glDeleteProgram,
+	GLTrace_glDeleteShader,
+	GLTrace_glDetachShader,
+	GLTrace_glDisableVertexAttribArray,
+	GLTrace_glEnableVertexAttribArray,
+	GLTrace_glGetActiveAttrib,
+	GLTrace_glGetActiveUniform,
+	GLTrace_glGetAttachedShaders,
+	GLTrace_glGetAttribLocation,
+	GLTrace_glGetProgramiv,
+	GLTrace_glGetProgramInfoLog,
+	GLTrace_glGetShaderiv,
+	GLTrace_glGetShaderInfoLog,
+	GLTrace_glGetShaderSource,
+	GLTrace_glGetUniformLocation,
+	GLTrace_glGetUniformfv,
+	GLTrace_glGetUniformiv,
+	GLTrace_glGetVertexAttribdv,
+	GLTrace_glGetVertexAttribfv,
+	GLTrace_glGetVertexAttribiv,
+	GLTrace_glGetVertexAttribPointerv,
+	GLTrace_glIsProgram,
+	GLTrace_glIsShader,
+	GLTrace_glLinkProgram,
+	GLTrace_glShaderSource,
+	GLTrace_glUseProgram,
+	GLTrace_glUniform1f,
+	GLTrace_glUniform2f,
+	GLTrace_glUniform3f,
+	GLTrace_glUniform4f,
+	GLTrace_glUniform1i,
+	GLTrace_glUniform2i,
+	GLTrace_glUniform3i,
+	GLTrace_glUniform4i,
+	GLTrace_glUniform1fv,
+	GLTrace_glUniform2fv,
+	GLTrace_glUniform3fv,
+	GLTrace_glUniform4fv,
+	GLTrace_glUniform1iv,
+	GLTrace_glUniform2iv,
+	GLTrace_glUniform3iv,
+	GLTrace_glUniform4iv,
+	GLTrace_glUniformMatrix2fv,
+	GLTrace_glUniformMatrix3fv,
+	GLTrace_glUniformMatrix4fv,
+	GLTrace_glValidateProgram,
+	GLTrace_glVertexAttrib1d,
+	GLTrace_glVertexAttrib1dv,
+	GLTrace_glVertexAttrib1f,
+	GLTrace_glVertexAttrib1fv,
+	GLTrace_glVertexAttrib1s,
+	GLTrace_glVertexAttrib1sv,
+	GLTrace_glVertexAttrib2d,
+	GLTrace_glVertexAttrib2dv,
+	GLTrace_glVertexAttrib2f,
+	GLTrace_glVertexAttrib2fv,
+	GLTrace_glVertexAttrib2s,
+	GLTrace_glVertexAttrib2sv,
+	GLTrace_glVertexAttrib3d,
+	GLTrace_glVertexAttrib3dv,
+	GLTrace_glVertexAttrib3f,
+	GLTrace_glVertexAttrib3fv,
+	GLTrace_glVertexAttrib3s,
+	GLTrace_glVertexAttrib3sv,
+	GLTrace_glVertexAttrib4Nbv,
+	GLTrace_glVertexAttrib4Niv,
+	GLTrace_glVertexAttrib4Nsv,
+	GLTrace_glVertexAttrib4Nub,
+	GLTrace_glVertexAttrib4Nubv,
+	GLTrace_glVertexAttrib4Nuiv,
+	GLTrace_glVertexAttrib4Nusv,
+	GLTrace_glVertexAttrib4bv,
+	GLTrace_glVertexAttrib4d,
+	GLTrace_glVertexAttrib4dv,
+	GLTrace_glVertexAttrib4f,
+	GLTrace_glVertexAttrib4fv,
+	GLTrace_glVertexAttrib4iv,
+	GLTrace_glVertexAttrib4s,
+	GLTrace_glVertexAttrib4sv,
+	GLTrace_glVertexAttrib4ubv,
+	GLTrace_glVertexAttrib4uiv,
+	GLTrace_glVertexAttrib4usv,
+	GLTrace_glVertexAttribPointer,
+	GLTrace_glUniformMatrix2x3fv,
+	GLTrace_glUniformMatrix3x2fv,
+	GLTrace_glUniformMatrix2x4fv,
+	GLTrace_glUniformMatrix4x2fv,
+	GLTrace_glUniformMatrix3x4fv,
+	GLTrace_glUniformMatrix4x3fv,
+	GLTrace_glColorMaski,
+	GLTrace_glGetBooleani_v,
+	GLTrace_glGetIntegeri_v,
+	GLTrace_glEnablei,
+	GLTrace_glDisablei,
+	GLTrace_glIsEnabledi,
+	GLTrace_glBeginTransformFeedback,
+	GLTrace_glEndTransformFeedback,
+	GLTrace_glBindBufferRange,
+	GLTrace_glBindBufferBase,
+	GLTrace_glTransformFeedbackVaryings,
+	GLTrace_glGetTransformFeedbackVarying,
+	GLTrace_glClampColor,
+	GLTrace_glBeginConditionalRender,
+	GLTrace_glEndConditionalRender,
+	GLTrace_glVertexAttribIPointer,
+	GLTrace_glGetVertexAttribIiv,
+	GLTrace_glGetVertexAttribIuiv,
+	GLTrace_glVertexAttribI1i,
+	GLTrace_glVertexAttribI2i,
+	GLTrace_glVertexAttribI3i,
+	GLTrace_glVertexAttribI4i,
+	GLTrace_glVertexAttribI1ui,
+	GLTrace_glVertexAttribI2ui,
+	GLTrace_glVertexAttribI3ui,
+	GLTrace_glVertexAttribI4ui,
+	GLTrace_glVertexAttribI1iv,
+	GLTrace_glVertexAttribI2iv,
+	GLTrace_glVertexAttribI3iv,
+	GLTrace_glVertexAttribI4iv,
+	GLTrace_glVertexAttribI1uiv,
+	GLTrace_glVertexAttribI2uiv,
+	GLTrace_glVertexAttribI3uiv,
+	GLTrace_glVertexAttribI4uiv,
+	GLTrace_glVertexAttribI4bv,
+	GLTrace_glVertexAttribI4sv,
+	GLTrace_glVertexAttribI4ubv,
+	GLTrace_glVertexAttribI4usv,
+	GLTrace_glGetUniformuiv,
+	GLTrace_glBindFragDataLocation,
+	GLTrace_glGetFragDataLocation,
+	GLTrace_glUniform1ui,
+	GLTrace_glUniform2ui,
+	GLTrace_glUniform3ui,
+	GLTrace_glUniform4ui,
+	GLTrace_glUniform1uiv,
+	GLTrace_glUniform2uiv,
+	GLTrace_glUniform3uiv,
+	GLTrace_glUniform4uiv,
+	GLTrace_glTexParameterIiv,
+	GLTrace_glTexParameterIuiv,
+	GLTrace_glGetTexParameterIiv,
+	GLTrace_glGetTexParameterIuiv,
+	GLTrace_glClearBufferiv,
+	GLTrace_glClearBufferuiv,
+	GLTrace_glClearBufferfv,
+	GLTrace_glClearBufferfi,
+	GLTrace_glGetStringi,
+	GLTrace_glIsRenderbuffer,
+	GLTrace_glBindRenderbuffer,
+	GLTrace_glDeleteRenderbuffers,
+	GLTrace_glGenRenderbuffers,
+	GLTrace_glRenderbufferStorage,
+	GLTrace_glGetRenderbufferParameteriv,
+	GLTrace_glIsFramebuffer,
+	GLTrace_glBindFramebuffer,
+	GLTrace_glDeleteFramebuffers,
+	GLTrace_glGenFramebuffers,
+	GLTrace_glCheckFramebufferStatus,
+	GLTrace_glFramebufferTexture1D,
+	GLTrace_glFramebufferTexture2D,
+	GLTrace_glFramebufferTexture3D,
+	GLTrace_glFramebufferRenderbuffer,
+	GLTrace_glGetFramebufferAttachmentParameteriv,
+	GLTrace_glGenerateMipmap,
+	GLTrace_glBlitFramebuffer,
+	GLTrace_glRenderbufferStorageMultisample,
+	GLTrace_glFramebufferTextureLayer,
+	GLTrace_glMapBufferRange,
+	GLTrace_glFlushMappedBufferRange,
+	GLTrace_glBindVertexArray,
+	GLTrace_glDeleteVertexArrays,
+	GLTrace_glGenVertexArrays,
+	GLTrace_glIsVertexArray,
+	GLTrace_glDrawArraysInstanced,
+	GLTrace_glDrawElementsInstanced,
+	GLTrace_glTexBuffer,
+	GLTrace_glPrimitiveRestartIndex,
+	GLTrace_glCopyBufferSubData,
+	GLTrace_glGetUniformIndices,
+	GLTrace_glGetActiveUniformsiv,
+	GLTrace_glGetActiveUniformName,
+	GLTrace_glGetUniformBlockIndex,
+	GLTrace_glGetActiveUniformBlockiv,
+	GLTrace_glGetActiveUniformBlockName,
+	GLTrace_glUniformBlockBinding,
+	GLTrace_glDrawElementsBaseVertex,
+	GLTrace_glDrawRangeElementsBaseVertex,
+	GLTrace_glDrawElementsInstancedBaseVertex,
+	GLTrace_glMultiDrawElementsBaseVertex,
+	GLTrace_glProvokingVertex,
+	GLTrace_glFenceSync,
+	GLTrace_glIsSync,
+	GLTrace_glDeleteSync,
+	GLTrace_glClientWaitSync,
+	GLTrace_glWaitSync,
+	GLTrace_glGetInteger64v,
+	GLTrace_glGetSynciv,
+	GLTrace_glGetInteger64i_v,
+	GLTrace_glGetBufferParameteri64v,
+	GLTrace_glFramebufferTexture,
+	GLTrace_glTexImage2DMultisample,
+	GLTrace_glTexImage3DMultisample,
+	GLTrace_glGetMultisamplefv,
+	GLTrace_glSampleMaski,
+	GLTrace_glBindFragDataLocationIndexed,
+	GLTrace_glGetFragDataIndex,
+	GLTrace_glGenSamplers,
+	GLTrace_glDeleteSamplers,
+	GLTrace_glIsSampler,
+	GLTrace_glBindSampler,
+	GLTrace_glSamplerParameteri,
+	GLTrace_glSamplerParameteriv,
+	GLTrace_glSamplerParameterf,
+	GLTrace_glSamplerParameterfv,
+	GLTrace_glSamplerParameterIiv,
+	GLTrace_glSamplerParameterIuiv,
+	GLTrace_glGetSamplerParameteriv,
+	GLTrace_glGetSamplerParameterIiv,
+	GLTrace_glGetSamplerParameterfv,
+	GLTrace_glGetSamplerParameterIuiv,
+	GLTrace_glQueryCounter,
+	GLTrace_glGetQueryObjecti64v,
+	GLTrace_glGetQueryObjectui64v,
+	GLTrace_glVertexAttribDivisor,
+	GLTrace_glVertexAttribP1ui,
+	GLTrace_glVertexAttribP1uiv,
+	GLTrace_glVertexAttribP2ui,
+	GLTrace_glVertexAttribP2uiv,
+	GLTrace_glVertexAttribP3ui,
+	GLTrace_glVertexAttribP3uiv,
+	GLTrace_glVertexAttribP4ui,
+	GLTrace_glVertexAttribP4uiv,
+	GLTraceEntries //<-- just used to track # of entry points
+};
+
+//counts since gl_trace_end_frame() (see gl_trace.hpp), and entry point names:
+extern GLTraceEntry gl_trace_entries[GLTraceEntries];
+extern char const *gl_trace_names[GLTraceEntries];
+
+//bytes of (tightly packed) pixel data in a 'width' x 'height' x 'depth' upload, by 'format' and 'type':
+uint64_t gl_trace_pixel_bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth);
+
+void APIENTRY gl_trace_glCullFace (GLenum mode);
+void APIENTRY gl_trace_glFrontFace (GLenum mode);
+void APIENTRY gl_trace_glHint (GLenum target, GLenum mode);
+void APIENTRY gl_trace_glLineWidth (GLfloat width);
+void APIENTRY gl_trace_glPointSize (GLfloat size);
+void APIENTRY gl_trace_glPolygonMode (GLenum face, GLenum mode);
+void APIENTRY gl_trace_glScissor (GLint x, GLint y, GLsizei width, GLsizei height);
+void APIENTRY gl_trace_glTexParameterf (GLenum target, GLenum pname, GLfloat param);
+void APIENTRY gl_trace_glTexParameterfv (GLenum target, GLenum pname, const GLfloat *params);
+void APIENTRY gl_trace_glTexParameteri (GLenum target, GLenum pname, GLint param);
+void APIENTRY gl_trace_glTexParameteriv (GLenum target, GLenum pname, const GLint *params);
+void APIENTRY gl_trace_glTexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels);
+void APIENTRY gl_trace_glTexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
+void APIENTRY gl_trace_glDrawBuffer (GLenum buf);
+void APIENTRY gl_trace_glClear (GLbitfield mask);
+void APIENTRY gl_trace_glClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void APIENTRY gl_trace_glClearStencil (GLint s);
+void APIENTRY gl_trace_glClearDepth (GLdouble depth);
+void APIENTRY gl_trace_glStencilMask (GLuint mask);
+void APIENTRY gl_trace_glColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+void APIENTRY gl_trace_glDepthMask (GLboolean flag);
+void APIENTRY gl_trace_glDisable (GLenum cap);
+void APIENTRY gl_trace_glEnable (GLenum cap);
+void APIENTRY gl_trace_glFinish (void);
+void APIENTRY gl_trace_glFlush (void);
+void APIENTRY gl_trace_glBlendFunc (GLenum sfactor, GLenum dfactor);
+void APIENTRY gl_trace_glLogicOp (GLenum opcode);
+void APIENTRY gl_trace_glStencilFunc (GLenum func, GLint ref, GLuint mask);
+void APIENTRY gl_trace_glStencilOp (GLenum fail, GLenum zfail, GLenum zpass);
+void APIENTRY gl_trace_glDepthFunc (GLenum func);
+void APIENTRY gl_trace_glPixelStoref (GLenum pname, GLfloat param);
+void APIENTRY gl_trace_glPixelStorei (GLenum pname, GLint param);
+void APIENTRY gl_trace_glReadBuffer (GLenum src);
+void APIENTRY gl_trace_glReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+void APIENTRY gl_trace_glGetBooleanv (GLenum pname, GLboolean *data);
+void APIENTRY gl_trace_glGetDoublev (GLenum pname, GLdouble *data);
+GLenum APIENTRY gl_trace_glGetError (void);
+void APIENTRY gl_trace_glGetFloatv (GLenum pname, GLfloat *data);
+void APIENTRY gl_trace_glGetIntegerv (GLenum pname, GLint *data);
+const GLubyte * APIENTRY gl_trace_glGetString (GLenum name);
+void APIENTRY gl_trace_glGetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels);
+void APIENTRY gl_trace_glGetTexParameterfv (GLenum target, GLenum pname, GLfloat *params);
+void APIENTRY gl_trace_glGetTexParameteriv (GLenum target, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params);
+void APIENTRY gl_trace_glGetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params);
+GLboolean APIENTRY gl_trace_glIsEnabled (GLenum cap);
+void APIENTRY gl_trace_glDepthRange (GLdouble n, GLdouble f);
+void APIENTRY gl_trace_glViewport (GLint x, GLint y, GLsizei width, GLsizei height);
+void APIENTRY gl_trace_glDrawArrays (GLenum mode, GLint first, GLsizei count);
+void APIENTRY gl_trace_glDrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices);
+void APIENTRY gl_trace_glGetPointerv (GLenum pname, void **params);
+void APIENTRY gl_trace_glPolygonOffset (GLfloat factor, GLfloat units);
+void APIENTRY gl_trace_glCopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);
+void APIENTRY gl_trace_glCopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);
+void APIENTRY gl_trace_glCopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
+void APIENTRY gl_trace_glCopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+void APIENTRY gl_trace_glTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
+void APIENTRY gl_trace_glTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+void APIENTRY gl_trace_glBindTexture (GLenum target, GLuint texture);
+void APIENTRY gl_trace_glDeleteTextures (GLsizei n, const GLuint *textures);
+void APIENTRY gl_trace_glGenTextures (GLsizei n, GLuint *textures);
+GLboolean APIENTRY gl_trace_glIsTexture (GLuint texture);
+void APIENTRY gl_trace_glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
+void APIENTRY gl_trace_glTexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
+void APIENTRY gl_trace_glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
+void APIENTRY gl_trace_glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+void APIENTRY gl_trace_glActiveTexture (GLenum texture);
+void APIENTRY gl_trace_glSampleCoverage (GLfloat value, GLboolean invert);
+void APIENTRY gl_trace_glCompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data);
+void APIENTRY gl_trace_glCompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data);
+void APIENTRY gl_trace_glCompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data);
+void APIENTRY gl_trace_glCompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data);
+void APIENTRY gl_trace_glCompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
+void APIENTRY gl_trace_glCompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data);
+void APIENTRY gl_trace_glGetCompressedTexImage (GLenum target, GLint level, void *img);
+void APIENTRY gl_trace_glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+void APIENTRY gl_trace_glMultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount);
+void APIENTRY gl_trace_glMultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount);
+void APIENTRY gl_trace_glPointParameterf (GLenum pname, GLfloat param);
+void APIENTRY gl_trace_glPointParameterfv (GLenum pname, const GLfloat *params);
+void APIENTRY gl_trace_glPointParameteri (GLenum pname, GLint param);
+void APIENTRY gl_trace_glPointParameteriv (GLenum pname, const GLint *params);
+void APIENTRY gl_trace_glBlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void APIENTRY gl_trace_glBlendEquation (GLenum mode);
+void APIENTRY gl_trace_glGenQueries (GLsizei n, GLuint *ids);
+void APIENTRY gl_trace_glDeleteQueries (GLsizei n, const GLuint *ids);
+GLboolean APIENTRY gl_trace_glIsQuery (GLuint id);
+void APIENTRY gl_trace_glBeginQuery (GLenum target, GLuint id);
+void APIENTRY gl_trace_glEndQuery (GLenum target);
+void APIENTRY gl_trace_glGetQueryiv (GLenum target, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetQueryObjectiv (GLuint id, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params);
+void APIENTRY gl_trace_glBindBuffer (GLenum target, GLuint buffer);
+void APIENTRY gl_trace_glDeleteBuffers (GLsizei n, const GLuint *buffers);
+void APIENTRY gl_trace_glGenBuffers (GLsizei n, GLuint *buffers);
+GLboolean APIENTRY gl_trace_glIsBuffer (GLuint buffer);
+void APIENTRY gl_trace_glBufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+void APIENTRY gl_trace_glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+void APIENTRY gl_trace_glGetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data);
+void * APIENTRY gl_trace_glMapBuffer (GLenum target, GLenum access);
+GLboolean APIENTRY gl_trace_glUnmapBuffer (GLenum target);
+void APIENTRY gl_trace_glGetBufferParameteriv (GLenum target, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetBufferPointerv (GLenum target, GLenum pname, void **params);
+void APIENTRY gl_trace_glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha);
+void APIENTRY gl_trace_glDrawBuffers (GLsizei n, const GLenum *bufs);
+void APIENTRY gl_trace_glStencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);
+void APIENTRY gl_trace_glStencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask);
+void APIENTRY gl_trace_glStencilMaskSeparate (GLenum face, GLuint mask);
+void APIENTRY gl_trace_glAttachShader (GLuint program, GLuint shader);
+void APIENTRY gl_trace_glBindAttribLocation (GLuint program, GLuint index, const GLchar *name);
+void APIENTRY gl_trace_glCompileShader (GLuint shader);
+GLuint APIENTRY gl_trace_glCreateProgram (void);
+GLuint APIENTRY gl_trace_glCreateShader (GLenum type);
+void APIENTRY gl_trace_glDeleteProgram (GLuint program);
+void APIENTRY gl_trace_glDeleteShader (GLuint shader);
+void APIENTRY gl_trace_glDetachShader (GLuint program, GLuint shader);
+void APIENTRY gl_trace_glDisableVertexAttribArray (GLuint index);
+void APIENTRY gl_trace_glEnableVertexAttribArray (GLuint index);
+void APIENTRY gl_trace_glGetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+void APIENTRY gl_trace_glGetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+void APIENTRY gl_trace_glGetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders);
+GLint APIENTRY gl_trace_glGetAttribLocation (GLuint program, const GLchar *name);
+void APIENTRY gl_trace_glGetProgramiv (GLuint program, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void APIENTRY gl_trace_glGetShaderiv (GLuint shader, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void APIENTRY gl_trace_glGetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source);
+GLint APIENTRY gl_trace_glGetUniformLocation (GLuint program, const GLchar *name);
+void APIENTRY gl_trace_glGetUniformfv (GLuint program, GLint location, GLfloat *params);
+void APIENTRY gl_trace_glGetUniformiv (GLuint program, GLint location, GLint *params);
+void APIENTRY gl_trace_glGetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params);
+void APIENTRY gl_trace_glGetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params);
+void APIENTRY gl_trace_glGetVertexAttribiv (GLuint index, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer);
+GLboolean APIENTRY gl_trace_glIsProgram (GLuint program);
+GLboolean APIENTRY gl_trace_glIsShader (GLuint shader);
+void APIENTRY gl_trace_glLinkProgram (GLuint program);
+void APIENTRY gl_trace_glShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
+void APIENTRY gl_trace_glUseProgram (GLuint program);
+void APIENTRY gl_trace_glUniform1f (GLint location, GLfloat v0);
+void APIENTRY gl_trace_glUniform2f (GLint location, GLfloat v0, GLfloat v1);
+void APIENTRY gl_trace_glUniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+void APIENTRY gl_trace_glUniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+void APIENTRY gl_trace_glUniform1i (GLint location, GLint v0);
+void APIENTRY gl_trace_glUniform2i (GLint location, GLint v0, GLint v1);
+void APIENTRY gl_trace_glUniform3i (GLint location, GLint v0, GLint v1, GLint v2);
+void APIENTRY gl_trace_glUniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
+void APIENTRY gl_trace_glUniform1fv (GLint location, GLsizei count, const GLfloat *value);
+void APIENTRY gl_trace_glUniform2fv (GLint location, GLsizei count, const GLfloat *value);
+void APIENTRY gl_trace_glUniform3fv (GLint location, GLsizei count, const GLfloat *value);
+void APIENTRY gl_trace_glUniform4fv (GLint location, GLsizei count, const GLfloat *value);
+void APIENTRY gl_trace_glUniform1iv (GLint location, GLsizei count, const GLint *value);
+void APIENTRY gl_trace_glUniform2iv (GLint location, GLsizei count, const GLint *value);
+void APIENTRY gl_trace_glUniform3iv (GLint location, GLsizei count, const GLint *value);
+void APIENTRY gl_trace_glUniform4iv (GLint location, GLsizei count, const GLint *value);
+void APIENTRY gl_trace_glUniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glUniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glValidateProgram (GLuint program);
+void APIENTRY gl_trace_glVertexAttrib1d (GLuint index, GLdouble x);
+void APIENTRY gl_trace_glVertexAttrib1dv (GLuint index, const GLdouble *v);
+void APIENTRY gl_trace_glVertexAttrib1f (GLuint index, GLfloat x);
+void APIENTRY gl_trace_glVertexAttrib1fv (GLuint index, const GLfloat *v);
+void APIENTRY gl_trace_glVertexAttrib1s (GLuint index, GLshort x);
+void APIENTRY gl_trace_glVertexAttrib1sv (GLuint index, const GLshort *v);
+void APIENTRY gl_trace_glVertexAttrib2d (GLuint index, GLdouble x, GLdouble y);
+void APIENTRY gl_trace_glVertexAttrib2dv (GLuint index, const GLdouble *v);
+void APIENTRY gl_trace_glVertexAttrib2f (GLuint index, GLfloat x, GLfloat y);
+void APIENTRY gl_trace_glVertexAttrib2fv (GLuint index, const GLfloat *v);
+void APIENTRY gl_trace_glVertexAttrib2s (GLuint index, GLshort x, GLshort y);
+void APIENTRY gl_trace_glVertexAttrib2sv (GLuint index, const GLshort *v);
+void APIENTRY gl_trace_glVertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z);
+void APIENTRY gl_trace_glVertexAttrib3dv (GLuint index, const GLdouble *v);
+void APIENTRY gl_trace_glVertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z);
+void APIENTRY gl_trace_glVertexAttrib3fv (GLuint index, const GLfloat *v);
+void APIENTRY gl_trace_glVertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z);
+void APIENTRY gl_trace_glVertexAttrib3sv (GLuint index, const GLshort *v);
+void APIENTRY gl_trace_glVertexAttrib4Nbv (GLuint index, const GLbyte *v);
+void APIENTRY gl_trace_glVertexAttrib4Niv (GLuint index, const GLint *v);
+void APIENTRY gl_trace_glVertexAttrib4Nsv (GLuint index, const GLshort *v);
+void APIENTRY gl_trace_glVertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
+void APIENTRY gl_trace_glVertexAttrib4Nubv (GLuint index, const GLubyte *v);
+void APIENTRY gl_trace_glVertexAttrib4Nuiv (GLuint index, const GLuint *v);
+void APIENTRY gl_trace_glVertexAttrib4Nusv (GLuint index, const GLushort *v);
+void APIENTRY gl_trace_glVertexAttrib4bv (GLuint index, const GLbyte *v);
+void APIENTRY gl_trace_glVertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+void APIENTRY gl_trace_glVertexAttrib4dv (GLuint index, const GLdouble *v);
+void APIENTRY gl_trace_glVertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+void APIENTRY gl_trace_glVertexAttrib4fv (GLuint index, const GLfloat *v);
+void APIENTRY gl_trace_glVertexAttrib4iv (GLuint index, const GLint *v);
+void APIENTRY gl_trace_glVertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
+void APIENTRY gl_trace_glVertexAttrib4sv (GLuint index, const GLshort *v);
+void APIENTRY gl_trace_glVertexAttrib4ubv (GLuint index, const GLubyte *v);
+void APIENTRY gl_trace_glVertexAttrib4uiv (GLuint index, const GLuint *v);
+void APIENTRY gl_trace_glVertexAttrib4usv (GLuint index, const GLushort *v);
+void APIENTRY gl_trace_glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
+void APIENTRY gl_trace_glUniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glUniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glUniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glUniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glUniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void APIENTRY gl_trace_glColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a);
+void APIENTRY gl_trace_glGetBooleani_v (GLenum target, GLuint index, GLboolean *data);
+void APIENTRY gl_trace_glGetIntegeri_v (GLenum target, GLuint index, GLint *data);
+void APIENTRY gl_trace_glEnablei (GLenum target, GLuint index);
+void APIENTRY gl_trace_glDisablei (GLenum target, GLuint index);
+GLboolean APIENTRY gl_trace_glIsEnabledi (GLenum target, GLuint index);
+void APIENTRY gl_trace_glBeginTransformFeedback (GLenum primitiveMode);
+void APIENTRY gl_trace_glEndTransformFeedback (void);
+void APIENTRY gl_trace_glBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+void APIENTRY gl_trace_glBindBufferBase (GLenum target, GLuint index, GLuint buffer);
+void APIENTRY gl_trace_glTransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode);
+void APIENTRY gl_trace_glGetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name);
+void APIENTRY gl_trace_glClampColor (GLenum target, GLenum clamp);
+void APIENTRY gl_trace_glBeginConditionalRender (GLuint id, GLenum mode);
+void APIENTRY gl_trace_glEndConditionalRender (void);
+void APIENTRY gl_trace_glVertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
+void APIENTRY gl_trace_glGetVertexAttribIiv (GLuint index, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params);
+void APIENTRY gl_trace_glVertexAttribI1i (GLuint index, GLint x);
+void APIENTRY gl_trace_glVertexAttribI2i (GLuint index, GLint x, GLint y);
+void APIENTRY gl_trace_glVertexAttribI3i (GLuint index, GLint x, GLint y, GLint z);
+void APIENTRY gl_trace_glVertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w);
+void APIENTRY gl_trace_glVertexAttribI1ui (GLuint index, GLuint x);
+void APIENTRY gl_trace_glVertexAttribI2ui (GLuint index, GLuint x, GLuint y);
+void APIENTRY gl_trace_glVertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z);
+void APIENTRY gl_trace_glVertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w);
+void APIENTRY gl_trace_glVertexAttribI1iv (GLuint index, const GLint *v);
+void APIENTRY gl_trace_glVertexAttribI2iv (GLuint index, const GLint *v);
+void APIENTRY gl_trace_glVertexAttribI3iv (GLuint index, const GLint *v);
+void APIENTRY gl_trace_glVertexAttribI4iv (GLuint index, const GLint *v);
+void APIENTRY gl_trace_glVertexAttribI1uiv (GLuint index, const GLuint *v);
+void APIENTRY gl_trace_glVertexAttribI2uiv (GLuint index, const GLuint *v);
+void APIENTRY gl_trace_glVertexAttribI3uiv (GLuint index, const GLuint *v);
+void APIENTRY gl_trace_glVertexAttribI4uiv (GLuint index, const GLuint *v);
+void APIENTRY gl_trace_glVertexAttribI4bv (GLuint index, const GLbyte *v);
+void APIENTRY gl_trace_glVertexAttribI4sv (GLuint index, const GLshort *v);
+void APIENTRY gl_trace_glVertexAttribI4ubv (GLuint index, const GLubyte *v);
+void APIENTRY gl_trace_glVertexAttribI4usv (GLuint index, const GLushort *v);
+void APIENTRY gl_trace_glGetUniformuiv (GLuint program, GLint location, GLuint *params);
+void APIENTRY gl_trace_glBindFragDataLocation (GLuint program, GLuint color, const GLchar *name);
+GLint APIENTRY gl_trace_glGetFragDataLocation (GLuint program, const GLchar *name);
+void APIENTRY gl_trace_glUniform1ui (GLint location, GLuint v0);
+void APIENTRY gl_trace_glUniform2ui (GLint location, GLuint v0, GLuint v1);
+void APIENTRY gl_trace_glUniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2);
+void APIENTRY gl_trace_glUniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3);
+void APIENTRY gl_trace_glUniform1uiv (GLint location, GLsizei count, const GLuint *value);
+void APIENTRY gl_trace_glUniform2uiv (GLint location, GLsizei count, const GLuint *value);
+void APIENTRY gl_trace_glUniform3uiv (GLint location, GLsizei count, const GLuint *value);
+void APIENTRY gl_trace_glUniform4uiv (GLint location, GLsizei count, const GLuint *value);
+void APIENTRY gl_trace_glTexParameterIiv (GLenum target, GLenum pname, const GLint *params);
+void APIENTRY gl_trace_glTexParameterIuiv (GLenum target, GLenum pname, const GLuint *params);
+void APIENTRY gl_trace_glGetTexParameterIiv (GLenum target, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params);
+void APIENTRY gl_trace_glClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value);
+void APIENTRY gl_trace_glClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value);
+void APIENTRY gl_trace_glClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value);
+void APIENTRY gl_trace_glClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil);
+const GLubyte * APIENTRY gl_trace_glGetStringi (GLenum name, GLuint index);
+GLboolean APIENTRY gl_trace_glIsRenderbuffer (GLuint renderbuffer);
+void APIENTRY gl_trace_glBindRenderbuffer (GLenum target, GLuint renderbuffer);
+void APIENTRY gl_trace_glDeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers);
+void APIENTRY gl_trace_glGenRenderbuffers (GLsizei n, GLuint *renderbuffers);
+void APIENTRY gl_trace_glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+void APIENTRY gl_trace_glGetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params);
+GLboolean APIENTRY gl_trace_glIsFramebuffer (GLuint framebuffer);
+void APIENTRY gl_trace_glBindFramebuffer (GLenum target, GLuint framebuffer);
+void APIENTRY gl_trace_glDeleteFramebuffers (GLsizei n, const GLuint *framebuffers);
+void APIENTRY gl_trace_glGenFramebuffers (GLsizei n, GLuint *framebuffers);
+GLenum APIENTRY gl_trace_glCheckFramebufferStatus (GLenum target);
+void APIENTRY gl_trace_glFramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+void APIENTRY gl_trace_glFramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+void APIENTRY gl_trace_glFramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset);
+void APIENTRY gl_trace_glFramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+void APIENTRY gl_trace_glGetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGenerateMipmap (GLenum target);
+void APIENTRY gl_trace_glBlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+void APIENTRY gl_trace_glRenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);
+void APIENTRY gl_trace_glFramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
+void * APIENTRY gl_trace_glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+void APIENTRY gl_trace_glFlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length);
+void APIENTRY gl_trace_glBindVertexArray (GLuint array);
+void APIENTRY gl_trace_glDeleteVertexArrays (GLsizei n, const GLuint *arrays);
+void APIENTRY gl_trace_glGenVertexArrays (GLsizei n, GLuint *arrays);
+GLboolean APIENTRY gl_trace_glIsVertexArray (GLuint array);
+void APIENTRY gl_trace_glDrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+void APIENTRY gl_trace_glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
+void APIENTRY gl_trace_glTexBuffer (GLenum target, GLenum internalformat, GLuint buffer);
+void APIENTRY gl_trace_glPrimitiveRestartIndex (GLuint index);
+void APIENTRY gl_trace_glCopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+void APIENTRY gl_trace_glGetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices);
+void APIENTRY gl_trace_glGetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName);
+GLuint APIENTRY gl_trace_glGetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName);
+void APIENTRY gl_trace_glGetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName);
+void APIENTRY gl_trace_glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
+void APIENTRY gl_trace_glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+void APIENTRY gl_trace_glDrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+void APIENTRY gl_trace_glDrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex);
+void APIENTRY gl_trace_glMultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex);
+void APIENTRY gl_trace_glProvokingVertex (GLenum mode);
+GLsync APIENTRY gl_trace_glFenceSync (GLenum condition, GLbitfield flags);
+GLboolean APIENTRY gl_trace_glIsSync (GLsync sync);
+void APIENTRY gl_trace_glDeleteSync (GLsync sync);
+GLenum APIENTRY gl_trace_glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout);
+void APIENTRY gl_trace_glWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout);
+void APIENTRY gl_trace_glGetInteger64v (GLenum pname, GLint64 *data);
+void APIENTRY gl_trace_glGetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values);
+void APIENTRY gl_trace_glGetInteger64i_v (GLenum target, GLuint index, GLint64 *data);
+void APIENTRY gl_trace_glGetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params);
+void APIENTRY gl_trace_glFramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level);
+void APIENTRY gl_trace_glTexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
+void APIENTRY gl_trace_glTexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
+void APIENTRY gl_trace_glGetMultisamplefv (GLenum pname, GLuint index, GLfloat *val);
+void APIENTRY gl_trace_glSampleMaski (GLuint maskNumber, GLbitfield mask);
+void APIENTRY gl_trace_glBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name);
+GLint APIENTRY gl_trace_glGetFragDataIndex (GLuint program, const GLchar *name);
+void APIENTRY gl_trace_glGenSamplers (GLsizei count, GLuint *samplers);
+void APIENTRY gl_trace_glDeleteSamplers (GLsizei count, const GLuint *samplers);
+GLboolean APIENTRY gl_trace_glIsSampler (GLuint sampler);
+void APIENTRY gl_trace_glBindSampler (GLuint unit, GLuint sampler);
+void APIENTRY gl_trace_glSamplerParameteri (GLuint sampler, GLenum pname, GLint param);
+void APIENTRY gl_trace_glSamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param);
+void APIENTRY gl_trace_glSamplerParameterf (GLuint sampler, GLenum pname, GLfloat param);
+void APIENTRY gl_trace_glSamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param);
+void APIENTRY gl_trace_glSamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param);
+void APIENTRY gl_trace_glSamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param);
+void APIENTRY gl_trace_glGetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params);
+void APIENTRY gl_trace_glGetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params);
+void APIENTRY gl_trace_glGetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params);
+void APIENTRY gl_trace_glQueryCounter (GLuint id, GLenum target);
+void APIENTRY gl_trace_glGetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params);
+void APIENTRY gl_trace_glGetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params);
+void APIENTRY gl_trace_glVertexAttribDivisor (GLuint index, GLuint divisor);
+void APIENTRY gl_trace_glVertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void APIENTRY gl_trace_glVertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void APIENTRY gl_trace_glVertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void APIENTRY gl_trace_glVertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void APIENTRY gl_trace_glVertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void APIENTRY gl_trace_glVertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void APIENTRY gl_trace_glVertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void APIENTRY gl_trace_glVertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+
+//(GL.cpp defines GL_TRACE_NO_MACROS, since its wrappers call the real functions)
+#ifndef GL_TRACE_NO_MACROS
+#define glCullFace gl_trace_glCullFace
+#define glFrontFace gl_trace_glFrontFace
+#define glHint gl_trace_glHint
+#define glLineWidth gl_trace_glLineWidth
+#define glPointSize gl_trace_glPointSize
+#define glPolygonMode gl_trace_glPolygonMode
+#define glScissor gl_trace_glScissor
+#define glTexParameterf gl_trace_glTexParameterf
+#define glTexParameterfv gl_trace_glTexParameterfv
+#define glTexParameteri gl_trace_glTexParameteri
+#define glTexParameteriv gl_trace_glTexParameteriv
+#define glTexImage1D gl_trace_glTexImage1D
+#define glTexImage2D gl_trace_glTexImage2D
+#define glDrawBuffer gl_trace_glDrawBuffer
+#define glClear gl_trace_glClear
+#define glClearColor gl_trace_glClearColor
+#define glClearStencil gl_trace_glClearStencil
+#define glClearDepth gl_trace_glClearDepth
+#define glStencilMask gl_trace_glStencilMask
+#define glColorMask gl_trace_glColorMask
+#define glDepthMask gl_trace_glDepthMask
+#define glDisable gl_trace_glDisable
+#define glEnable gl_trace_glEnable
+#define glFinish gl_trace_glFinish
+#define glFlush gl_trace_glFlush
+#define glBlendFunc gl_trace_glBlendFunc
+#define glLogicOp gl_trace_glLogicOp
+#define glStencilFunc gl_trace_glStencilFunc
+#define glStencilOp gl_trace_glStencilOp
+#define glDepthFunc gl_trace_glDepthFunc
+#define glPixelStoref gl_trace_glPixelStoref
+#define glPixelStorei gl_trace_glPixelStorei
+#define glReadBuffer gl_trace_glReadBuffer
+#define glReadPixels gl_trace_glReadPixels
+#define glGetBooleanv gl_trace_glGetBooleanv
+#define glGetDoublev gl_trace_glGetDoublev
+#define glGetError gl_trace_glGetError
+#define glGetFloatv gl_trace_glGetFloatv
+#define glGetIntegerv gl_trace_glGetIntegerv
+#define glGetString gl_trace_glGetString
+#define glGetTexImage gl_trace_glGetTexImage
+#define glGetTexParameterfv gl_trace_glGetTexParameterfv
+#define glGetTexParameteriv gl_trace_glGetTexParameteriv
+#define glGetTexLevelParameterfv gl_trace_glGetTexLevelParameterfv
+#define glGetTexLevelParameteriv gl_trace_glGetTexLevelParameteriv
+#define glIsEnabled gl_trace_glIsEnabled
+#define glDepthRange gl_trace_glDepthRange
+#define glViewport gl_trace_glViewport
+#define glDrawArrays gl_trace_glDrawArrays
+#define glDrawElements gl_trace_glDrawElements
+#define glGetPointerv gl_trace_glGetPointerv
+#define glPolygonOffset gl_trace_glPolygonOffset
+#define glCopyTexImage1D gl_trace_glCopyTexImage1D
+#define glCopyTexImage2D gl_trace_glCopyTexImage2D
+#define glCopyTexSubImage1D gl_trace_glCopyTexSubImage1D
+#define glCopyTexSubImage2D gl_trace_glCopyTexSubImage2D
+#define glTexSubImage1D gl_trace_glTexSubImage1D
+#define glTexSubImage2D gl_trace_glTexSubImage2D
+#define glBindTexture gl_trace_glBindTexture
+#define glDeleteTextures gl_trace_glDeleteTextures
+#define glGenTextures gl_trace_glGenTextures
+#define glIsTexture gl_trace_glIsTexture
+#define glDrawRangeElements gl_trace_glDrawRangeElements
+#define glTexImage3D gl_trace_glTexImage3D
+#define glTexSubImage3D gl_trace_glTexSubImage3D
+#define glCopyTexSubImage3D gl_trace_glCopyTexSubImage3D
+#define glActiveTexture gl_trace_glActiveTexture
+#define glSampleCoverage gl_trace_glSampleCoverage
+#define glCompressedTexImage3D gl_trace_glCompressedTexImage3D
+#define glCompressedTexImage2D gl_trace_glCompressedTexImage2D
+#define glCompressedTexImage1D gl_trace_glCompressedTexImage1D
+#define glCompressedTexSubImage3D gl_trace_glCompressedTexSubImage3D
+#define glCompressedTexSubImage2D gl_trace_glCompressedTexSubImage2D
+#define glCompressedTexSubImage1D gl_trace_glCompressedTexSubImage1D
+#define glGetCompressedTexImage gl_trace_glGetCompressedTexImage
+#define glBlendFuncSeparate gl_trace_glBlendFuncSeparate
+#define glMultiDrawArrays gl_trace_glMultiDrawArrays
+#define glMultiDrawElements gl_trace_glMultiDrawElements
+#define glPointParameterf gl_trace_glPointParameterf
+#define glPointParameterfv gl_trace_glPointParameterfv
+#define glPointParameteri gl_trace_glPointParameteri
+#define glPointParameteriv gl_trace_glPointParameteriv
+#define glBlendColor gl_trace_glBlendColor
+#define glBlendEquation gl_trace_glBlendEquation
+#define glGenQueries gl_trace_glGenQueries
+#define glDeleteQueries gl_trace_glDeleteQueries
+#define glIsQuery gl_trace_glIsQuery
+#define glBeginQuery gl_trace_glBeginQuery
+#define glEndQuery gl_trace_glEndQuery
+#define glGetQueryiv gl_trace_glGetQueryiv
+#define glGetQueryObjectiv gl_trace_glGetQueryObjectiv
+#define glGetQueryObjectuiv gl_trace_glGetQueryObjectuiv
+#define glBindBuffer gl_trace_glBindBuffer
+#define glDeleteBuffers gl_trace_glDeleteBuffers
+#define glGenBuffers gl_trace_glGenBuffers
+#define glIsBuffer gl_trace_glIsBuffer
+#define glBufferData gl_trace_glBufferData
+#define glBufferSubData gl_trace_glBufferSubData
+#define glGetBufferSubData gl_trace_glGetBufferSubData
+#define glMapBuffer gl_trace_glMapBuffer
+#define glUnmapBuffer gl_trace_glUnmapBuffer
+#define glGetBufferParameteriv gl_trace_glGetBufferParameteriv
+#define glGetBufferPointerv gl_trace_glGetBufferPointerv
+#define glBlendEquationSeparate gl_trace_glBlendEquationSeparate
+#define glDrawBuffers gl_trace_glDrawBuffers
+#define glStencilOpSeparate gl_trace_glStencilOpSeparate
+#define glStencilFuncSeparate gl_trace_glStencilFuncSeparate
+#define glStencilMaskSeparate gl_trace_glStencilMaskSeparate
+#define glAttachShader gl_trace_glAttachShader
+#define glBindAttribLocation gl_trace_glBindAttribLocation
+#define glCompileShader gl_trace_glCompileShader
+#define glCreateProgram gl_trace_glCreateProgram
+#define glCreateShader gl_trace_glCreateShader
+#define glDeleteProgram gl_trace_glDeleteProgram
+#define glDeleteShader gl_trace_glDeleteShader
+#define glDetachShader gl_trace_glDetachShader
+#define glDisableVertexAttribArray gl_trace_glDisableVertexAttribArray
+#define glEnableVertexAttribArray gl_trace_glEnableVertexAttribArray
+#define glGetActiveAttrib gl_trace_glGetActiveAttrib
+#define glGetActiveUniform gl_trace_glGetActiveUniform
+#define glGetAttachedShaders gl_trace_glGetAttachedShaders
+#define glGetAttribLocation gl_trace_glGetAttribLocation
+#define glGetProgramiv gl_trace_glGetProgramiv
+#define glGetProgramInfoLog gl_trace_glGetProgramInfoLog
+#define glGetShaderiv gl_trace_glGetShaderiv
+#define glGetShaderInfoLog gl_trace_glGetShaderInfoLog
+#define glGetShaderSource gl_trace_glGetShaderSource
+#define glGetUniformLocation gl_trace_glGetUniformLocation
+#define glGetUniformfv gl_trace_glGetUniformfv
+#define glGetUniformiv gl_trace_glGetUniformiv
+#define glGetVertexAttribdv gl_trace_glGetVertexAttribdv
+#define glGetVertexAttribfv gl_trace_glGetVertexAttribfv
+#define glGetVertexAttribiv gl_trace_glGetVertexAttribiv
+#define glGetVertexAttribPointerv gl_trace_glGetVertexAttribPointerv
+#define glIsProgram gl_trace_glIsProgram
+#define glIsShader gl_trace_glIsShader
+#define glLinkProgram gl_trace_glLinkProgram
+#define glShaderSource gl_trace_glShaderSource
+#define glUseProgram gl_trace_glUseProgram
+#define glUniform1f gl_trace_glUniform1f
+#define glUniform2f gl_trace_glUniform2f
+#define glUniform3f gl_trace_glUniform3f
+#define glUniform4f gl_trace_glUniform4f
+#define glUniform1i gl_trace_glUniform1i
+#define glUniform2i gl_trace_glUniform2i
+#define glUniform3i gl_trace_glUniform3i
+#define glUniform4i gl_trace_glUniform4i
+#define glUniform1fv gl_trace_glUniform1fv
+#define glUniform2fv gl_trace_glUniform2fv
+#define glUniform3fv gl_trace_glUniform3fv
+#define glUniform4fv gl_trace_glUniform4fv
+#define glUniform1iv gl_trace_glUniform1iv
+#define glUniform2iv gl_trace_glUniform2iv
+#define glUniform3iv gl_trace_glUniform3iv
+#define glUniform4iv gl_trace_glUniform4iv
+#define glUniformMatrix2fv gl_trace_glUniformMatrix2fv
+#define glUniformMatrix3fv gl_trace_glUniformMatrix3fv
+#define glUniformMatrix4fv gl_trace_glUniformMatrix4fv
+#define glValidateProgram gl_trace_glValidateProgram
+#define glVertexAttrib1d gl_trace_glVertexAttrib1d
+#define glVertexAttrib1dv gl_trace_glVertexAttrib1dv
+#define glVertexAttrib1f gl_trace_glVertexAttrib1f
+#define glVertexAttrib1fv gl_trace_glVertexAttrib1fv
+#define glVertexAttrib1s gl_trace_glVertexAttrib1s
+#define glVertexAttrib1sv gl_trace_glVertexAttrib1sv
+#define glVertexAttrib2d gl_trace_glVertexAttrib2d
+#define glVertexAttrib2dv gl_trace_glVertexAttrib2dv
+#define glVertexAttrib2f gl_trace_glVertexAttrib2f
+#define glVertexAttrib2fv gl_trace_glVertexAttrib2fv
+#define glVertexAttrib2s gl_trace_glVertexAttrib2s
+#define glVertexAttrib2sv gl_trace_glVertexAttrib2sv
+#define glVertexAttrib3d gl_trace_glVertexAttrib3d
+#define glVertexAttrib3dv gl_trace_glVertexAttrib3dv
+#define glVertexAttrib3f gl_trace_glVertexAttrib3f
+#define glVertexAttrib3fv gl_trace_glVertexAttrib3fv
+#define glVertexAttrib3s gl_trace_glVertexAttrib3s
+#define glVertexAttrib3sv gl_trace_glVertexAttrib3sv
+#define glVertexAttrib4Nbv gl_trace_glVertexAttrib4Nbv
+#define glVertexAttrib4Niv gl_trace_glVertexAttrib4Niv
+#define glVertexAttrib4Nsv gl_trace_glVertexAttrib4Nsv
+#define glVertexAttrib4Nub gl_trace_glVertexAttrib4Nub
+#define glVertexAttrib4Nubv gl_trace_glVertexAttrib4Nubv
+#define glVertexAttrib4Nuiv gl_trace_glVertexAttrib4Nuiv
+#define glVertexAttrib4Nusv gl_trace_glVertexAttrib4Nusv
+#define glVertexAttrib4bv gl_trace_glVertexAttrib4bv
+#define glVertexAttrib4d gl_trace_glVertexAttrib4d
+#define glVertexAttrib4dv gl_trace_glVertexAttrib4dv
+#define glVertexAttrib4f gl_trace_glVertexAttrib4f
+#define glVertexAttrib4fv gl_trace_glVertexAttrib4fv
+#define glVertexAttrib4iv gl_trace_glVertexAttrib4iv
+#define glVertexAttrib4s gl_trace_glVertexAttrib4s
+#define glVertexAttrib4sv gl_trace_glVertexAttrib4sv
+#define glVertexAttrib4ubv gl_trace_glVertexAttrib4ubv
+#define glVertexAttrib4uiv gl_trace_glVertexAttrib4uiv
+#define glVertexAttrib4usv gl_trace_glVertexAttrib4usv
+#define glVertexAttribPointer gl_trace_glVertexAttribPointer
+#define glUniformMatrix2x3fv gl_trace_glUniformMatrix2x3fv
+#define glUniformMatrix3x2fv gl_trace_glUniformMatrix3x2fv
+#define glUniformMatrix2x4fv gl_trace_glUniformMatrix2x4fv
+#define glUniformMatrix4x2fv gl_trace_glUniformMatrix4x2fv
+#define glUniformMatrix3x4fv gl_trace_glUniformMatrix3x4fv
+#define glUniformMatrix4x3fv gl_trace_glUniformMatrix4x3fv
+#define glColorMaski gl_trace_glColorMaski
+#define glGetBooleani_v gl_trace_glGetBooleani_v
+#define glGetIntegeri_v gl_trace_glGetIntegeri_v
+#define glEnablei gl_trace_glEnablei
+#define glDisablei gl_trace_glDisablei
+#define glIsEnabledi gl_trace_glIsEnabledi
+#define glBeginTransformFeedback gl_trace_glBeginTransformFeedback
+#define glEndTransformFeedback gl_trace_glEndTransformFeedback
+#define glBindBufferRange gl_trace_glBindBufferRange
+#define glBindBufferBase gl_trace_glBindBufferBase
+#define glTransformFeedbackVaryings gl_trace_glTransformFeedbackVaryings
+#define glGetTransformFeedbackVarying gl_trace_glGetTransformFeedbackVarying
+#define glClampColor gl_trace_glClampColor
+#define glBeginConditionalRender gl_trace_glBeginConditionalRender
+#define glEndConditionalRender gl_trace_glEndConditionalRender
+#define glVertexAttribIPointer gl_trace_glVertexAttribIPointer
+#define glGetVertexAttribIiv gl_trace_glGetVertexAttribIiv
+#define glGetVertexAttribIuiv gl_trace_glGetVertexAttribIuiv
+#define glVertexAttribI1i gl_trace_glVertexAttribI1i
+#define glVertexAttribI2i gl_trace_glVertexAttribI2i
+#define glVertexAttribI3i gl_trace_glVertexAttribI3i
+#define glVertexAttribI4i gl_trace_glVertexAttribI4i
+#define glVertexAttribI1ui gl_trace_glVertexAttribI1ui
+#define glVertexAttribI2ui gl_trace_glVertexAttribI2ui
+#define glVertexAttribI3ui gl_trace_glVertexAttribI3ui
+#define glVertexAttribI4ui gl_trace_glVertexAttribI4ui
+#define glVertexAttribI1iv gl_trace_glVertexAttribI1iv
+#define glVertexAttribI2iv gl_trace_glVertexAttribI2iv
+#define glVertexAttribI3iv gl_trace_glVertexAttribI3iv
+#define glVertexAttribI4iv gl_trace_glVertexAttribI4iv
+#define glVertexAttribI1uiv gl_trace_glVertexAttribI1uiv
+#define glVertexAttribI2uiv gl_trace_glVertexAttribI2uiv
+#define glVertexAttribI3uiv gl_trace_glVertexAttribI3uiv
+#define glVertexAttribI4uiv gl_trace_glVertexAttribI4uiv
+#define glVertexAttribI4bv gl_trace_glVertexAttribI4bv
+#define glVertexAttribI4sv gl_trace_glVertexAttribI4sv
+#define glVertexAttribI4ubv gl_trace_glVertexAttribI4ubv
+#define glVertexAttribI4usv gl_trace_glVertexAttribI4usv
+#define glGetUniformuiv gl_trace_glGetUniformuiv
+#define glBindFragDataLocation gl_trace_glBindFragDataLocation
+#define glGetFragDataLocation gl_trace_glGetFragDataLocation
+#define glUniform1ui gl_trace_glUniform1ui
+#define glUniform2ui gl_trace_glUniform2ui
+#define glUniform3ui gl_trace_glUniform3ui
+#define glUniform4ui gl_trace_glUniform4ui
+#define glUniform1uiv gl_trace_glUniform1uiv
+#define glUniform2uiv gl_trace_glUniform2uiv
+#define glUniform3uiv gl_trace_glUniform3uiv
+#define glUniform4uiv gl_trace_glUniform4uiv
+#define glTexParameterIiv gl_trace_glTexParameterIiv
+#define glTexParameterIuiv gl_trace_glTexParameterIuiv
+#define glGetTexParameterIiv gl_trace_glGetTexParameterIiv
+#define glGetTexParameterIuiv gl_trace_glGetTexParameterIuiv
+#define glClearBufferiv gl_trace_glClearBufferiv
+#define glClearBufferuiv gl_trace_glClearBufferuiv
+#define glClearBufferfv gl_trace_glClearBufferfv
+#define glClearBufferfi gl_trace_glClearBufferfi
+#define glGetStringi gl_trace_glGetStringi
+#define glIsRenderbuffer gl_trace_glIsRenderbuffer
+#define glBindRenderbuffer gl_trace_glBindRenderbuffer
+#define glDeleteRenderbuffers gl_trace_glDeleteRenderbuffers
+#define glGenRenderbuffers gl_trace_glGenRenderbuffers
+#define glRenderbufferStorage gl_trace_glRenderbufferStorage
+#define glGetRenderbufferParameteriv gl_trace_glGetRenderbufferParameteriv
+#define glIsFramebuffer gl_trace_glIsFramebuffer
+#define glBindFramebuffer gl_trace_glBindFramebuffer
+#define glDeleteFramebuffers gl_trace_glDeleteFramebuffers
+#define glGenFramebuffers gl_trace_glGenFramebuffers
+#define glCheckFramebufferStatus gl_trace_glCheckFramebufferStatus
+#define glFramebufferTexture1D gl_trace_glFramebufferTexture1D
+#define glFramebufferTexture2D gl_trace_glFramebufferTexture2D
+#define glFramebufferTexture3D gl_trace_glFramebufferTexture3D
+#define glFramebufferRenderbuffer gl_trace_glFramebufferRenderbuffer
+#define glGetFramebufferAttachmentParameteriv gl_trace_glGetFramebufferAttachmentParameteriv
+#define glGenerateMipmap gl_trace_glGenerateMipmap
+#define glBlitFramebuffer gl_trace_glBlitFramebuffer
+#define glRenderbufferStorageMultisample gl_trace_glRenderbufferStorageMultisample
+#define glFramebufferTextureLayer gl_trace_glFramebufferTextureLayer
+#define glMapBufferRange gl_trace_glMapBufferRange
+#define glFlushMappedBufferRange gl_trace_glFlushMappedBufferRange
+#define glBindVertexArray gl_trace_glBindVertexArray
+#define glDeleteVertexArrays gl_trace_glDeleteVertexArrays
+#define glGenVertexArrays gl_trace_glGenVertexArrays
+#define glIsVertexArray gl_trace_glIsVertexArray
+#define glDrawArraysInstanced gl_trace_glDrawArraysInstanced
+#define glDrawElementsInstanced gl_trace_glDrawElementsInstanced
+#define glTexBuffer gl_trace_glTexBuffer
+#define glPrimitiveRestartIndex gl_trace_glPrimitiveRestartIndex
+#define glCopyBufferSubData gl_trace_glCopyBufferSubData
+#define glGetUniformIndices gl_trace_glGetUniformIndices
+#define glGetActiveUniformsiv gl_trace_glGetActiveUniformsiv
+#define glGetActiveUniformName gl_trace_glGetActiveUniformName
+#define glGetUniformBlockIndex gl_trace_glGetUniformBlockIndex
+#define glGetActiveUniformBlockiv gl_trace_glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockName gl_trace_glGetActiveUniformBlockName
+#define glUniformBlockBinding gl_trace_glUniformBlockBinding
+#define glDrawElementsBaseVertex gl_trace_glDrawElementsBaseVertex
+#define glDrawRangeElementsBaseVertex gl_trace_glDrawRangeElementsBaseVertex
+#define glDrawElementsInstancedBaseVertex gl_trace_glDrawElementsInstancedBaseVertex
+#define glMultiDrawElementsBaseVertex gl_trace_glMultiDrawElementsBaseVertex
+#define glProvokingVertex gl_trace_glProvokingVertex
+#define glFenceSync gl_trace_glFenceSync
+#define glIsSync gl_trace_glIsSync
+#define glDeleteSync gl_trace_glDeleteSync
+#define glClientWaitSync gl_trace_glClientWaitSync
+#define glWaitSync gl_trace_glWaitSync
+#define glGetInteger64v gl_trace_glGetInteger64v
+#define glGetSynciv gl_trace_glGetSynciv
+#define glGetInteger64i_v gl_trace_glGetInteger64i_v
+#define glGetBufferParameteri64v gl_trace_glGetBufferParameteri64v
+#define glFramebufferTexture gl_trace_glFramebufferTexture
+#define glTexImage2DMultisample gl_trace_glTexImage2DMultisample
+#define glTexImage3DMultisample gl_trace_glTexImage3DMultisample
+#define glGetMultisamplefv gl_trace_glGetMultisamplefv
+#define glSampleMaski gl_trace_glSampleMaski
+#define glBindFragDataLocationIndexed gl_trace_glBindFragDataLocationIndexed
+#define glGetFragDataIndex gl_trace_glGetFragDataIndex
+#define glGenSamplers gl_trace_glGenSamplers
+#define glDeleteSamplers gl_trace_glDeleteSamplers
+#define glIsSampler gl_trace_glIsSampler
+#define glBindSampler gl_trace_glBindSampler
+#define glSamplerParameteri gl_trace_glSamplerParameteri
+#define glSamplerParameteriv gl_trace_glSamplerParameteriv
+#define glSamplerParameterf gl_trace_glSamplerParameterf
+#define glSamplerParameterfv gl_trace_glSamplerParameterfv
+#define glSamplerParameterIiv gl_trace_glSamplerParameterIiv
+#define glSamplerParameterIuiv gl_trace_glSamplerParameterIuiv
+#define glGetSamplerParameteriv gl_trace_glGetSamplerParameteriv
+#define glGetSamplerParameterIiv gl_trace_glGetSamplerParameterIiv
+#define glGetSamplerParameterfv gl_trace_glGetSamplerParameterfv
+#define glGetSamplerParameterIuiv gl_trace_glGetSamplerParameterIuiv
+#define glQueryCounter gl_trace_glQueryCounter
+#define glGetQueryObjecti64v gl_trace_glGetQueryObjecti64v
+#define glGetQueryObjectui64v gl_trace_glGetQueryObjectui64v
+#define glVertexAttribDivisor gl_trace_glVertexAttribDivisor
+#define glVertexAttribP1ui gl_trace_glVertexAttribP1ui
+#define glVertexAttribP1uiv gl_trace_glVertexAttribP1uiv
+#define glVertexAttribP2ui gl_trace_glVertexAttribP2ui
+#define glVertexAttribP2uiv gl_trace_glVertexAttribP2uiv
+#define glVertexAttribP3ui gl_trace_glVertexAttribP3ui
+#define glVertexAttribP3uiv gl_trace_glVertexAttribP3uiv
+#define glVertexAttribP4ui gl_trace_glVertexAttribP4ui
+#define glVertexAttribP4uiv gl_trace_glVertexAttribP4uiv
+#endif //GL_TRACE_NO_MACROS
+
+#endif //GL_TRACE
@@ -1,32 +1,340 @@
 #include "Load.hpp"
 
-#include <array>
-#include <list>
+#include "ThreadPool.hpp"
+#include "MappedChunks.hpp"
+
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace {
-	std::array< std::list< std::function< void() > >, MaxLoadTag > &get_load_lists() {
-		static std::array< std::list< std::function< void() > >, MaxLoadTag > load_lists;
-		return load_lists;
+	struct LoadFunction {
+		void const *key = nullptr; //(nullptr for tagged functions)
+		LoadPhase phase = LoadOnGL;
+		LoadTag tag = MaxLoadTag; //(MaxLoadTag if not tagged)
+		std::vector< LoadAfter > after;
+		std::function< void() > fn;
+		LoadSource source;
+	};
+	std::vector< LoadFunction > &get_load_functions() {
+		static std::vector< LoadFunction > load_functions;
+		return load_functions;
+	}
+
+	std::unordered_set< void const * > &get_lazy_loads() {
+		static std::unordered_set< void const * > lazy_loads;
+		return lazy_loads;
 	}
+
+	std::vector< LoadRecord > records;
+	double total_time = 0.0;
+}
+
+void add_load_function(LoadTag tag, std::function< void() > const &fn, LoadSource source) {
+	assert(tag < MaxLoadTag);
+	LoadFunction function;
+	function.tag = tag;
+	function.fn = fn;
+	function.source = source;
+	get_load_functions().emplace_back(function);
 }
 
-void add_load_function(LoadTag tag, std::function< void() > const &fn) {
-	auto &load_lists = get_load_lists();
-	assert(tag < load_lists.size());
-	load_lists[tag].emplace_back(fn);
+void add_load_function(void const *key, LoadPhase phase, std::vector< LoadAfter > const &after, std::function< void() > const &fn, LoadSource source) {
+	assert(key);
+	if (phase == LoadOnUse) throw std::runtime_error("LoadOnUse functions aren't called by call_load_functions(); use a Load< T >.");
+	LoadFunction function;
+	function.key = key;
+	function.phase = phase;
+	function.after = after;
+	function.fn = fn;
+	function.source = source;
+	get_load_functions().emplace_back(function);
+}
+
+void add_lazy_load(void const *key) {
+	get_lazy_loads().emplace(key);
+}
+
+void load_in_background(std::function< void() > const &fn) {
+	//(one thread, so prefetching doesn't compete with the game for every core)
+	static ThreadPool background(1);
+	background.run([fn](){
+		try {
+			fn();
+		} catch (std::exception &e) {
+			std::cerr << "Background load failed: " << e.what() << std::endl;
+		}
+	});
+}
+
+std::vector< LoadRecord > const &load_records() {
+	return records;
+}
+
+double load_total_time() {
+	return total_time;
 }
 
 void call_load_functions() {
 	static bool has_been_called = false;
 	assert(!has_been_called && "call_load_functions should only be called *once*");
 	has_been_called = true;
+	(void)has_been_called; //(only read by the assert, which release builds leave out)
+
+	auto &functions = get_load_functions();
+	auto started = std::chrono::steady_clock::now();
+
+	//build the dependency graph:
+	struct Node {
+		std::vector< size_t > dependents; //functions that need this one
+		uint32_t waiting_on = 0; //functions this one still needs
+		std::vector< std::function< bool() > > polls; //...and checks it waits on after that (see LoadAfter::ready)
+	};
+	std::vector< Node > nodes(functions.size());
+	std::unordered_map< void const *, size_t > index_of;
+	for (size_t i = 0; i < functions.size(); ++i) {
+		if (functions[i].key && !index_of.emplace(functions[i].key, i).second) {
+			throw std::runtime_error("The same Load<> was added twice.");
+		}
+	}
+	bool any_cpu = false;
+	for (size_t i = 0; i < functions.size(); ++i) {
+		for (LoadAfter const &after : functions[i].after) {
+			if (get_lazy_loads().count(after.key)) continue; //(loads itself when used)
+			auto f = index_of.find(after.key);
+			if (f == index_of.end()) throw std::runtime_error("A Load<> depends on something that is never loaded.");
+			nodes[f->second].dependents.emplace_back(i);
+			nodes[i].waiting_on += 1;
+			if (after.ready) nodes[i].polls.emplace_back(after.ready);
+		}
+		if (functions[i].tag != MaxLoadTag) {
+			for (size_t j = 0; j < functions.size(); ++j) {
+				if (functions[j].tag < functions[i].tag) {
+					nodes[j].dependents.emplace_back(i);
+					nodes[i].waiting_on += 1;
+				}
+			}
+		}
+		if (functions[i].phase == LoadOnCPU) any_cpu = true;
+	}
+
+	//run functions as they become ready; CPU ones on the pool, GL ones on this thread:
+	std::mutex mutex; //guards everything below:
+	std::condition_variable changed; //signalled when a CPU function finishes
+	std::deque< size_t > gl_ready; //GL functions that are ready to run
+	std::deque< size_t > polling; //functions whose dependencies have loaded, but whose polls haven't all passed
+	size_t finished = 0;
+	uint32_t running = 0; //CPU functions queued or running
+	std::exception_ptr error; //first failure (no new functions start after one)
 
-	auto &load_lists = get_load_lists();
-	for (auto &fn_list : load_lists) {
-		while (!fn_list.empty()) {
-			(*fn_list.begin())(); //call first function in the list
-			fn_list.pop_front(); //remove from list
+	std::unordered_map< std::thread::id, uint32_t > thread_index; //loader threads, numbered in order of first use
+	thread_index.emplace(std::this_thread::get_id(), 0);
+
+	//call function 'i', and note what it did: (call *without* mutex held)
+	records.assign(functions.size(), LoadRecord());
+	auto call = [&](size_t i) {
+		LoadRecord &record = records[i];
+		record.source = functions[i].source;
+		record.phase = functions[i].phase;
+		uint64_t bytes_before = chunk_bytes_read();
+		auto before = std::chrono::steady_clock::now();
+		record.start = std::chrono::duration< double >(before - started).count();
+		try {
+			functions[i].fn();
+		} catch (...) {
+			record.duration = std::chrono::duration< double >(std::chrono::steady_clock::now() - before).count();
+			throw;
+		}
+		auto after = std::chrono::steady_clock::now();
+		record.duration = std::chrono::duration< double >(after - before).count();
+		record.bytes = chunk_bytes_read() - bytes_before;
+		std::unique_lock< std::mutex > lock(mutex);
+		record.thread = thread_index.emplace(std::this_thread::get_id(), uint32_t(thread_index.size())).first->second;
+	};
+
+	std::unique_ptr< ThreadPool > pool; //(declared after the state its tasks use, so it is joined first)
+	if (any_cpu) pool.reset(new ThreadPool());
+
+	std::function< void(size_t) > ready; //call with mutex held:
+	auto finish = [&](size_t i) { //call with mutex held
+		finished += 1;
+		for (size_t d : nodes[i].dependents) {
+			assert(nodes[d].waiting_on > 0);
+			nodes[d].waiting_on -= 1;
+			if (nodes[d].waiting_on == 0) ready(d);
+		}
+	};
+	ready = [&](size_t i) {
+		if (error) return;
+		if (!nodes[i].polls.empty()) {
+			polling.emplace_back(i);
+			return;
+		}
+		if (functions[i].phase == LoadOnGL) {
+			gl_ready.emplace_back(i);
+			return;
 		}
+		running += 1;
+		pool->run([&,i](){
+			//(exceptions must not escape a pool task, so they are handed back to the GL thread)
+			std::exception_ptr failed;
+			try {
+				call(i);
+			} catch (...) {
+				failed = std::current_exception();
+			}
+			std::unique_lock< std::mutex > lock(mutex);
+			running -= 1;
+			if (failed) {
+				if (!error) error = failed;
+			} else {
+				finish(i);
+			}
+			changed.notify_all();
+		});
+	};
+
+	//check the polls of waiting functions, and start those whose polls all pass: (call with mutex held)
+	// (returns true if any started, or a poll threw)
+	auto poll = [&]() {
+		bool started = false;
+		for (auto p = polling.begin(); p != polling.end(); /* later */) {
+			size_t i = *p;
+			bool passed = true;
+			try {
+				for (auto const &check : nodes[i].polls) {
+					if (!check()) {
+						passed = false;
+						break;
+					}
+				}
+			} catch (...) {
+				if (!error) error = std::current_exception();
+				return true;
+			}
+			if (passed) {
+				p = polling.erase(p);
+				nodes[i].polls.clear();
+				ready(i);
+				started = true;
+			} else {
+				++p;
+			}
+		}
+		return started;
+	};
+
+	std::unique_lock< std::mutex > lock(mutex);
+	for (size_t i = 0; i < functions.size(); ++i) {
+		if (nodes[i].waiting_on == 0) ready(i);
+	}
+	while (true) {
+		if (error) {
+			if (running == 0) break;
+		} else if (!gl_ready.empty()) {
+			size_t i = gl_ready.front();
+			gl_ready.pop_front();
+			lock.unlock();
+			std::exception_ptr failed;
+			try {
+				call(i);
+			} catch (...) {
+				failed = std::current_exception();
+			}
+			lock.lock();
+			if (failed) error = failed;
+			else finish(i);
+			continue;
+		} else if (!polling.empty() && poll()) {
+			continue;
+		} else if (finished == functions.size()) {
+			break;
+		} else if (running == 0) {
+			if (!polling.empty()) {
+				//nothing else to do, so stop polling and just run (and wait on whatever the polls were waiting on):
+				size_t i = polling.front();
+				polling.pop_front();
+				nodes[i].polls.clear();
+				ready(i);
+				continue;
+			}
+			error = std::make_exception_ptr(std::runtime_error("Some Load<>s depend on each other in a cycle."));
+			break;
+		}
+		if (polling.empty()) changed.wait(lock);
+		else changed.wait_for(lock, std::chrono::milliseconds(1)); //(wake up to poll again)
+	}
+	lock.unlock();
+
+	pool.reset();
+	functions.clear();
+	total_time = std::chrono::duration< double >(std::chrono::steady_clock::now() - started).count();
+	if (error) std::rethrow_exception(error);
+}
+
+void print_load_report(std::ostream &out, size_t max_lines) {
+	std::vector< LoadRecord const * > slowest;
+	double busy = 0.0;
+	for (auto const &record : records) {
+		slowest.emplace_back(&record);
+		busy += record.duration;
+	}
+	std::stable_sort(slowest.begin(), slowest.end(), [](LoadRecord const *a, LoadRecord const *b) {
+		return a->duration > b->duration;
+	});
+
+	std::ios state(nullptr);
+	state.copyfmt(out);
+	out << "Loaded " << records.size() << " assets in " << std::fixed << std::setprecision(2) << (total_time * 1000.0) << " ms"
+	    << " (" << (busy * 1000.0) << " ms of work):\n";
+	for (size_t i = 0; i < slowest.size() && i < max_lines; ++i) {
+		LoadRecord const &record = *slowest[i];
+		std::string thread = (record.thread == 0 ? "GL" : "cpu" + std::to_string(record.thread));
+		out << "  " << std::setw(9) << (record.duration * 1000.0) << " ms  "
+		    << std::left << std::setw(5) << thread << std::right
+		    << std::setw(10) << record.bytes << " bytes  "
+		    << record.source.file << ":" << record.source.line << "\n";
+	}
+	if (slowest.size() > max_lines) out << "  (and " << (slowest.size() - max_lines) << " more)\n";
+	out.copyfmt(state);
+	out.flush();
+}
+
+void write_load_trace(std::string const &path) {
+	std::ofstream out(path, std::ios::binary);
+	if (!out) throw std::runtime_error("Failed to open '" + path + "' to write a load trace.");
+
+	//file names may hold backslashes (on Windows), which JSON strings need escaped:
+	auto escape = [](char const *str) {
+		std::string escaped;
+		for (char const *c = str; *c; ++c) {
+			if (*c == '\\' || *c == '"') escaped += '\\';
+			escaped += *c;
+		}
+		return escaped;
+	};
+
+	out << "{\"traceEvents\":[\n";
+	for (size_t i = 0; i < records.size(); ++i) {
+		LoadRecord const &record = records[i];
+		out << (i ? ",\n" : "")
+		    << "{\"name\":\"" << escape(record.source.file) << ":" << record.source.line << "\","
+		    << "\"cat\":\"" << (record.phase == LoadOnCPU ? "cpu" : "gl") << "\","
+		    << "\"ph\":\"X\",\"pid\":0,\"tid\":" << record.thread << ","
+		    << "\"ts\":" << uint64_t(record.start * 1e6) << ",\"dur\":" << uint64_t(record.duration * 1e6) << ","
+		    << "\"args\":{\"bytes\":" << record.bytes << "}}";
 	}
+	out << "\n]}\n";
+	if (!out) throw std::runtime_error("Failed to write load trace to '" + path + "'.");
 }
@@ -6,24 +6,50 @@
  * This is useful for global-scope resources that need an OpenGL context:
  *
  * //at global scope:
- * Load< Mesh > main_mesh([]() -> const Mesh * {
+ * Load< Mesh > main_mesh(LoadOnGL, []() -> const Mesh * {
  *     return &Meshes.get("Main");
- * });
+ * }, { Meshes_load }); //<-- runs after Meshes_load (another Load<>)
  *
  * //later:
  * void GameMode::draw() {
  *     glBindVertexArray(main_mesh->vao);
  * }
  *
- * Load<> is built on the add_load_function() call that adds a function to one of several lists of functions that are called after the OpenGL canvas is initialized.
+ * Load<> is built on the add_load_function() call that adds a function to a graph of functions that are called after the OpenGL canvas is initialized.
+ *
+ * Every function says which phase it runs in, and which other Load<>s it needs:
+ *  - LoadOnCPU functions (file reads, PNG decoding, parsing chunks) run on a pool of worker threads, and must not call OpenGL.
+ *  - LoadOnGL functions (uploads, shader compiles) run on the thread that owns the OpenGL context.
+ * A function runs as soon as everything it needs has loaded, so CPU work overlaps with GL work (and with other CPU work).
+ * A dependency can also wait on a check that doesn't block (e.g., gl_program_ready()), so GL work the driver
+ *  does in the background overlaps with everything else, too.
+ *
+ * The older 'tags' still work: a function added with a tag runs in the GL phase, after every function with an earlier tag.
  *
- * These functions are grouped by 'tags', which allow some sequencing of calls.
- * (particularly, this is useful for loading large data blobs [e.g. Meshes] before looking up individual elements within them.)
+ * Load<>s that aren't needed for the first frame can use LoadOnUse instead. call_load_functions() skips them;
+ *  they load the first time they are used (on whichever thread uses them, exactly once even if several race),
+ *  or sooner, on a background thread, if prefetch() is called:
+ *
+ * Load< Music > boss_music(LoadOnUse, []() -> const Music * {
+ *     return new Music(data_path("boss.opus"));
+ * });
+ * //...when the player enters the level before the boss:
+ * boss_music.prefetch();
+ *
+ * Every function is timed (along with the thread it ran on, the bytes it read through MappedChunks,
+ *  and the file:line of its Load<>); see load_records(), print_load_report(), and write_load_trace().
  *
  */
 
+#include <atomic>
 #include <functional>
+#include <initializer_list>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 enum LoadTag : uint32_t {
 	LoadTagEarly,
@@ -32,39 +58,144 @@ enum LoadTag : uint32_t {
 	MaxLoadTag //<-- just used to track # of load tags
 };
 
+enum LoadPhase : uint32_t {
+	LoadOnCPU, //any thread (no OpenGL calls!)
+	LoadOnGL, //the thread with the OpenGL context
+	LoadOnUse, //whichever thread first uses it (not called by call_load_functions(); only for Load< T >)
+};
+
+//Where a loading function was declared (defaults to the caller's file and line, where the compiler can tell):
+struct LoadSource {
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1926)
+	LoadSource(char const *file_ = __builtin_FILE(), uint32_t line_ = __builtin_LINE()) : file(file_), line(line_) { }
+#else
+	LoadSource(char const *file_ = "?", uint32_t line_ = 0) : file(file_), line(line_) { }
+#endif
+	char const *file;
+	uint32_t line;
+};
+
+template< typename T >
+struct Load;
+
+//Something a Load<> needs loaded first (any other Load<>):
+// (with 'ready', it also waits until 'ready()' returns true -- for work the driver finishes in the background, say;
+//  'ready' is checked on the GL thread between other loading functions, and is given up on
+//  (and the function run anyway) once there is nothing else left to do)
+struct LoadAfter {
+	template< typename T >
+	LoadAfter(Load< T > const &load, std::function< bool() > const &ready_ = nullptr) : key(&load), ready(ready_) { }
+	void const *key;
+	std::function< bool() > ready;
+};
+
 //Add a function to an internal list of loading functions:
 // (only call *before* "call_load_functions()")
-void add_load_function(LoadTag tag, std::function< void() > const &fn);
+void add_load_function(LoadTag tag, std::function< void() > const &fn, LoadSource source = LoadSource());
+
+//Add a function that runs in 'phase' once the functions added with each key in 'after' have run:
+// ('key' names this function for others to depend on -- Load<> uses its own address)
+// (only call *before* "call_load_functions()")
+void add_load_function(void const *key, LoadPhase phase, std::vector< LoadAfter > const &after, std::function< void() > const &fn, LoadSource source = LoadSource());
+
+//Note that 'key' is a LoadOnUse Load<> (others may list it in 'after'; it is loaded when they use it):
+void add_lazy_load(void const *key);
 
 //Call all loading functions:
-// (loading functions may throw exceptions if they fail.)
-// (only call *once*)
+// (loading functions may throw exceptions if they fail; the first one is rethrown here once running functions stop.)
+// (only call *once*, from the thread with the OpenGL context)
 void call_load_functions();
 
+//Run 'fn' on the (single) background loading thread:
+// (exceptions are caught and printed -- prefetch() uses this, and the Load<> will throw again when it is used)
+void load_in_background(std::function< void() > const &fn);
+
+//What each loading function did during call_load_functions(), in the order they were added:
+struct LoadRecord {
+	LoadSource source;
+	LoadPhase phase = LoadOnGL;
+	uint32_t thread = 0; //0 is the GL thread; loader threads are numbered from 1 in order of first use
+	double start = 0.0; //seconds after call_load_functions() started
+	double duration = 0.0; //seconds
+	uint64_t bytes = 0; //read through MappedChunks
+};
+std::vector< LoadRecord > const &load_records();
+double load_total_time(); //wall-clock seconds taken by call_load_functions()
+
+//Print the loading functions, slowest first (at most 'max_lines' of them):
+void print_load_report(std::ostream &out, size_t max_lines = 10);
+
+//Save the loading functions as a trace (Chrome's "trace event" JSON, for chrome://tracing or ui.perfetto.dev):
+void write_load_trace(std::string const &path);
+
 
 //work-around for MSVC not accepting this as a lambda:
 template< typename T >
 T const *new_T() { return new T; }
 
+//Calls a function the first time it is needed, from any thread:
+// (if the function throws, the next caller tries again)
+struct LoadOnce {
+	LoadOnce(std::function< void() > const &fn_) : fn(fn_) { }
+	void operator()() {
+		if (done.load(std::memory_order_acquire)) return;
+		std::lock_guard< std::mutex > lock(mutex);
+		if (done.load(std::memory_order_relaxed)) return;
+		fn();
+		done.store(true, std::memory_order_release);
+	}
+	std::function< void() > fn;
+	std::mutex mutex;
+	std::atomic< bool > done{false};
+};
+
 template< typename T >
 struct Load {
 	//Constructing a Load< T > adds the passed function to the list of functions to call:
-	Load(LoadTag tag, const std::function< T const *() > &load_fn = new_T< T >) : value(nullptr) {
+	Load(LoadTag tag, const std::function< T const *() > &load_fn = new_T< T >, LoadSource source = LoadSource()) : value(nullptr) {
 		add_load_function(tag, [this,load_fn](){
 			this->value = load_fn();
 			if (!(this->value)) {
 				throw std::runtime_error("Loading failed.");
 			}
-		});
+		}, source);
+	}
+	//...or to run in 'phase' after the Load<>s in 'after':
+	// (LoadOnUse Load<>s don't need an 'after' list; the Load<>s they use load as they're used)
+	Load(LoadPhase phase, const std::function< T const *() > &load_fn = new_T< T >, std::initializer_list< LoadAfter > after = {}, LoadSource source = LoadSource()) : value(nullptr) {
+		std::function< void() > load = [this,load_fn](){
+			this->value = load_fn();
+			if (!(this->value)) {
+				throw std::runtime_error("Loading failed.");
+			}
+		};
+		if (phase == LoadOnUse) {
+			lazy.reset(new LoadOnce(load));
+			add_lazy_load(this);
+		} else {
+			add_load_function(this, phase, after, load, source);
+		}
+	}
+
+	//Start loading a LoadOnUse Load<> on the background loading thread, if it hasn't loaded yet:
+	// (only for load functions that don't call OpenGL; does nothing for other Load<>s)
+	void prefetch() {
+		if (lazy) load_in_background([this](){ (*lazy)(); });
 	}
 
 	//Make a "Load< T >" behave like a "T const *":
-	explicit operator bool() { return value != nullptr; }
-	operator T const *() { return value; }
-	T const &operator*() { return *value; }
-	T const *operator->() { return value; }
+	// (these load a LoadOnUse Load<>, if it hasn't loaded yet)
+	explicit operator bool() { use(); return value != nullptr; }
+	operator T const *() { use(); return value; }
+	T const &operator*() { use(); return *value; }
+	T const *operator->() { use(); return value; }
+
+	T const *value; //(nullptr until loaded; read a LoadOnUse Load<> through the operators above, which wait for it)
 
-	T const *value;
+	std::unique_ptr< LoadOnce > lazy; //(only for LoadOnUse)
+	void use() {
+		if (lazy) (*lazy)();
+	}
 };
 
 
@@ -73,8 +204,11 @@ struct Load {
 template< >
 struct Load< void > {
 	//Constructing a Load< T > adds the passed function to the list of functions to call:
-	Load( LoadTag tag, const std::function< void() > &load_fn) {
-		add_load_function(tag, load_fn);
+	Load( LoadTag tag, const std::function< void() > &load_fn, LoadSource source = LoadSource()) {
+		add_load_function(tag, load_fn, source);
+	}
+	Load( LoadPhase phase, const std::function< void() > &load_fn, std::initializer_list< LoadAfter > after = {}, LoadSource source = LoadSource()) {
+		add_load_function(this, phase, after, load_fn, source);
 	}
 };
 
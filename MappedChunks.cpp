@@ -0,0 +1,187 @@
+#include "MappedChunks.hpp"
+#include "read_write_chunk.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedChunks::MappedChunks(std::string const &path_) : path(path_) {
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("Failed to open '" + path + "'");
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size)) {
+		CloseHandle(file);
+		throw std::runtime_error("Failed to get size of '" + path + "'");
+	}
+	size = size_t(file_size.QuadPart);
+	if (size != 0) {
+		handle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (handle) data = reinterpret_cast< char const * >(MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0));
+	}
+	CloseHandle(file); //(the mapping keeps the file open)
+	if (size != 0 && !data) {
+		if (handle) CloseHandle(handle);
+		throw std::runtime_error("Failed to map '" + path + "'");
+	}
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) throw std::runtime_error("Failed to open '" + path + "'");
+	struct stat info;
+	if (fstat(fd, &info) != 0) {
+		close(fd);
+		throw std::runtime_error("Failed to get size of '" + path + "'");
+	}
+	size = size_t(info.st_size);
+	if (size != 0) {
+		void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapped == MAP_FAILED) {
+			close(fd);
+			throw std::runtime_error("Failed to map '" + path + "'");
+		}
+		data = reinterpret_cast< char const * >(mapped);
+	}
+	close(fd); //(the mapping keeps the file open)
+#endif
+
+	try {
+		read_directory();
+	} catch (...) {
+		unmap(); //(destructor doesn't run if the constructor throws)
+		throw;
+	}
+}
+
+void MappedChunks::read_directory() {
+	struct ChunkHeader {
+		char magic[4];
+		uint32_t size;
+	};
+	static_assert(sizeof(ChunkHeader) == 8, "header is packed");
+
+	if (size >= sizeof(ChunkHeader) && std::memcmp(data, "ctoc", 4) == 0) {
+		ChunkHeader header;
+		std::memcpy(&header, data, sizeof(header));
+		if (header.size < 8 || size - sizeof(ChunkHeader) < header.size) {
+			throw std::runtime_error("Truncated table of contents in '" + path + "'");
+		}
+		uint32_t count = 0;
+		std::memcpy(&version, data + 8, 4);
+		std::memcpy(&count, data + 12, 4);
+		if (version != ChunkDirectoryVersion) {
+			throw std::runtime_error("'" + path + "' has table of contents version " + std::to_string(version) + "; expected " + std::to_string(uint32_t(ChunkDirectoryVersion)) + " (rebuild it with pack-tiles)");
+		}
+		if ((header.size - 8) / 16 < count) {
+			throw std::runtime_error("Truncated table of contents in '" + path + "'");
+		}
+		directory.reserve(count);
+		for (uint32_t i = 0; i < count; i++) {
+			char const *at_entry = data + 16 + 16 * i;
+			Entry entry;
+			std::memcpy(&entry.offset, at_entry + 4, 4);
+			std::memcpy(&entry.size, at_entry + 8, 4);
+			std::memcpy(&entry.crc32, at_entry + 12, 4);
+			if (entry.offset < sizeof(ChunkHeader) || entry.offset > size || size - entry.offset < entry.size) {
+				throw std::runtime_error("Table of contents entry out of range in '" + path + "'");
+			}
+			uint32_t stored_size;
+			std::memcpy(&stored_size, data + entry.offset - 4, 4);
+			entry.compressed = (stored_size & ChunkCompressedBit) != 0;
+			directory.emplace(std::string(at_entry, 4), entry);
+		}
+		at = sizeof(ChunkHeader) + header.size; //(sequential reads start after the table of contents)
+		chunk_bytes_read() += at;
+	} else {
+		//no table of contents; walk the chunk headers instead:
+		for (size_t offset = 0; size - offset >= sizeof(ChunkHeader); ) {
+			ChunkHeader header;
+			std::memcpy(&header, data + offset, sizeof(header));
+			Entry entry;
+			entry.compressed = (header.size & ChunkCompressedBit) != 0;
+			header.size &= ~ChunkCompressedBit;
+			if (size - offset - sizeof(ChunkHeader) < header.size) break;
+			entry.offset = uint32_t(offset + sizeof(ChunkHeader));
+			entry.size = header.size;
+			directory.emplace(std::string(header.magic, 4), entry);
+			offset += sizeof(ChunkHeader) + header.size;
+		}
+	}
+}
+
+MappedChunks::Entry const &MappedChunks::checked_entry(std::string const &magic) const {
+	auto f = directory.find(magic);
+	if (f == directory.end()) {
+		throw std::runtime_error("No chunk '" + magic + "' in '" + path + "'");
+	}
+	Entry const &entry = f->second;
+	chunk_bytes_read() += entry.size;
+	if (version != 0) {
+		uint32_t crc = uint32_t(::crc32(0L, reinterpret_cast< Bytef const * >(data + entry.offset), uInt(entry.size)));
+		if (crc != entry.crc32) {
+			throw std::runtime_error("Chunk '" + magic + "' in '" + path + "' is corrupt (checksum mismatch)");
+		}
+	}
+	return entry;
+}
+
+char const *MappedChunks::chunk_data(std::string const &magic, uint32_t *size_) const {
+	Entry const &entry = checked_entry(magic);
+	if (entry.compressed) {
+		throw std::runtime_error("Chunk '" + magic + "' in '" + path + "' is compressed; use load_chunk()");
+	}
+	*size_ = entry.size;
+	return data + entry.offset;
+}
+
+//(compressed chunk data starts with codec, uncompressed size, compressed size; see read_write_chunk.hpp)
+uint32_t MappedChunks::chunk_size(std::string const &magic) const {
+	auto f = directory.find(magic);
+	if (f == directory.end()) {
+		throw std::runtime_error("No chunk '" + magic + "' in '" + path + "'");
+	}
+	Entry const &entry = f->second;
+	if (!entry.compressed) return entry.size;
+	if (entry.size < 12) throw std::runtime_error("Truncated compressed chunk '" + magic + "' in '" + path + "'");
+	uint32_t raw_size;
+	std::memcpy(&raw_size, data + entry.offset + 4, 4);
+	return raw_size;
+}
+
+void MappedChunks::read(std::string const &magic, void *to, size_t to_size) const {
+	Entry const &entry = checked_entry(magic);
+	if (to_size != chunk_size(magic)) {
+		throw std::runtime_error("Chunk '" + magic + "' in '" + path + "' is " + std::to_string(chunk_size(magic)) + " bytes, expected " + std::to_string(to_size));
+	}
+	if (!entry.compressed) {
+		std::memcpy(to, data + entry.offset, to_size);
+		return;
+	}
+	uint32_t info[3]; //codec, uncompressed size, compressed size
+	std::memcpy(info, data + entry.offset, sizeof(info));
+	if (info[2] > entry.size - sizeof(info)) {
+		throw std::runtime_error("Truncated compressed chunk '" + magic + "' in '" + path + "'");
+	}
+	decompress_chunk(ChunkCodec(info[0]), data + entry.offset + sizeof(info), info[2], to, to_size);
+}
+
+MappedChunks::~MappedChunks() {
+	unmap();
+}
+
+void MappedChunks::unmap() {
+#ifdef _WIN32
+	if (data) UnmapViewOfFile(data);
+	if (handle) CloseHandle(handle);
+	handle = nullptr;
+#else
+	if (data) munmap(const_cast< char * >(data), size);
+#endif
+	data = nullptr;
+	size = 0;
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+/*
+ * MappedChunks -- read chunks (in the read_write_chunk.hpp format) straight out of a
+ *  memory-mapped file.
+ *
+ * read_chunk() here returns a ChunkSpan that points into the mapping, so nothing is
+ *  copied (or allocated) until the caller copies the elements it actually wants to keep.
+ *  Spans are only valid while the MappedChunks is alive.
+ *
+ * Files that start with a table of contents (see write_chunk_directory() in
+ *  read_write_chunk.hpp) can also be read in any order with find_chunk(), which looks
+ *  the chunk up by name and checks its crc32. Since the file is mapped, chunks that are
+ *  never looked at are never read from disk. (Files without a table of contents get a
+ *  directory built by walking their chunk headers once, with no checksums.)
+ *
+ * Compressed chunks (see read_write_chunk.hpp) can't be viewed in place; copy them out with
+ *  load_chunk() or MappedChunks::read(), which decompress straight into the destination.
+ *
+ * Example:
+ *   MappedChunks chunks(data_path("../tiles.bin"));
+ *   ChunkSpan< PPU466::Palette > palettes = read_chunk< PPU466::Palette >(chunks, "pal0");
+ *   std::copy(palettes.begin(), palettes.end(), ppu.palette_table.begin());
+ *
+ */
+
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+//Bytes of chunk data read (or checksummed) by any MappedChunks on the calling thread:
+// (Load.cpp uses this to report how much each loading function read)
+inline uint64_t &chunk_bytes_read() {
+	static thread_local uint64_t bytes = 0;
+	return bytes;
+}
+
+//A read-only, bounds-checked view of 'count' T's:
+template< typename T >
+struct ChunkSpan {
+	ChunkSpan() = default;
+	ChunkSpan(T const *data_, size_t count_) : data(data_), count(count_) { }
+
+	T const *begin() const { return data; }
+	T const *end() const { return data + count; }
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+
+	//throws std::out_of_range if i >= size():
+	T const &operator[](size_t i) const {
+		if (i >= count) throw std::out_of_range("ChunkSpan index " + std::to_string(i) + " out of range (size " + std::to_string(count) + ")");
+		return data[i];
+	}
+
+	T const *data = nullptr;
+	size_t count = 0;
+};
+
+struct MappedChunks {
+	//map 'path' read-only (throws on failure):
+	MappedChunks(std::string const &path);
+	~MappedChunks();
+	MappedChunks(MappedChunks const &) = delete;
+	MappedChunks &operator=(MappedChunks const &) = delete;
+
+	std::string path;
+	char const *data = nullptr; //start of mapped file
+	size_t size = 0; //size of mapped file in bytes
+
+	size_t at = 0; //offset of the next chunk header (read_chunk() reads chunks in order)
+
+	//table of contents (version is 0 if the file didn't have one):
+	uint32_t version = 0;
+	struct Entry {
+		uint32_t offset = 0; //of chunk data, from start of file
+		uint32_t size = 0; //of chunk data as stored
+		uint32_t crc32 = 0;
+		bool compressed = false;
+	};
+	std::unordered_map< std::string, Entry > directory;
+
+	bool has_chunk(std::string const &magic) const { return directory.count(magic) != 0; }
+
+	//data of chunk 'magic' (throws if missing, compressed, or if its checksum doesn't match):
+	// (safe to call from several threads at once, like everything below)
+	char const *chunk_data(std::string const &magic, uint32_t *size) const;
+
+	//size of chunk 'magic' once decompressed:
+	uint32_t chunk_size(std::string const &magic) const;
+
+	//copy (or decompress) chunk 'magic' into 'size' bytes at 'to':
+	// (throws if 'size' isn't chunk_size(magic))
+	void read(std::string const &magic, void *to, size_t size) const;
+
+	//----- internals -----
+	void *handle = nullptr; //(Windows file mapping handle; unused elsewhere)
+	void read_directory(); //fill in 'directory' (and 'version', 'at')
+	Entry const &checked_entry(std::string const &magic) const; //look up + verify checksum
+	void unmap();
+};
+
+//read the chunk at from->at (which must have the given magic) and advance past it:
+// (the file's chunk data must be suitably aligned for T; tiles.bin's chunks are)
+template< typename T >
+ChunkSpan< T > read_chunk(MappedChunks &from, std::string const &magic) {
+	static_assert(std::is_trivially_copyable< T >::value, "chunks hold plain data");
+
+	struct ChunkHeader {
+		char magic[4] = {'\0', '\0', '\0', '\0'};
+		uint32_t size = 0;
+	};
+	static_assert(sizeof(ChunkHeader) == 8, "header is packed");
+
+	if (from.size - from.at < sizeof(ChunkHeader)) {
+		throw std::runtime_error("Failed to read chunk header in '" + from.path + "'");
+	}
+	ChunkHeader header;
+	std::memcpy(&header, from.data + from.at, sizeof(header));
+	if (std::string(header.magic,4) != magic) {
+		throw std::runtime_error("Unexpected magic number in chunk (expected '" + magic + "') in '" + from.path + "'");
+	}
+	if (header.size & 0x80000000) { //(ChunkCompressedBit)
+		throw std::runtime_error("Chunk '" + magic + "' is compressed; use load_chunk()");
+	}
+	if (header.size % sizeof(T) != 0) {
+		throw std::runtime_error("Size of chunk not divisible by element size");
+	}
+	char const *begin = from.data + from.at + sizeof(ChunkHeader);
+	if (from.size - from.at - sizeof(ChunkHeader) < header.size) {
+		throw std::runtime_error("Failed to read chunk data.");
+	}
+	if (reinterpret_cast< uintptr_t >(begin) % alignof(T) != 0) {
+		throw std::runtime_error("Chunk '" + magic + "' is not aligned for its element type");
+	}
+
+	from.at += sizeof(ChunkHeader) + header.size;
+	return ChunkSpan< T >(reinterpret_cast< T const * >(begin), header.size / sizeof(T));
+}
+
+//find chunk 'magic' anywhere in the file, using the table of contents:
+template< typename T >
+ChunkSpan< T > find_chunk(MappedChunks const &from, std::string const &magic) {
+	static_assert(std::is_trivially_copyable< T >::value, "chunks hold plain data");
+
+	uint32_t size = 0;
+	char const *begin = from.chunk_data(magic, &size);
+	if (size % sizeof(T) != 0) {
+		throw std::runtime_error("Size of chunk not divisible by element size");
+	}
+	if (reinterpret_cast< uintptr_t >(begin) % alignof(T) != 0) {
+		throw std::runtime_error("Chunk '" + magic + "' is not aligned for its element type");
+	}
+	return ChunkSpan< T >(reinterpret_cast< T const * >(begin), size / sizeof(T));
+}
+
+//copy chunk 'magic' (compressed or not) into a vector:
+template< typename T >
+void load_chunk(MappedChunks const &from, std::string const &magic, std::vector< T > *to) {
+	static_assert(std::is_trivially_copyable< T >::value, "chunks hold plain data");
+
+	uint32_t size = from.chunk_size(magic);
+	if (size % sizeof(T) != 0) {
+		throw std::runtime_error("Size of chunk not divisible by element size");
+	}
+	to->resize(size / sizeof(T));
+	from.read(magic, to->data(), size);
+}
@@ -0,0 +1,92 @@
+#include "ObjectStore.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+void ObjectStore::import(std::vector< Object > const &objects) {
+	for_each_archetype([](auto &archetype){
+		archetype.entries.clear();
+	});
+
+	//append an object to whichever archetype has a matching Type:
+	auto add = [](auto &archetype, Object const &obj) {
+		typedef typename std::decay_t< decltype(archetype) >::Kind Kind;
+		if (obj.obj_type != Kind::Type) return;
+		archetype.entries.emplace_back();
+		archetype.entries.back().at = glm::u8vec2(obj.x, obj.y);
+		archetype.entries.back().reached = obj.reached;
+	};
+	for (auto const &obj : objects) {
+		for_each_archetype([&](auto &archetype){
+			add(archetype, obj);
+		});
+	}
+}
+
+uint32_t ObjectStore::collide(glm::vec2 const &player_at) {
+	// Collision check
+	// Referenced from https://github.com/15-466/15-466-f21-base0/blob/main/PongMode.cpp
+	uint32_t events = ObjectEventNone;
+	for_each_archetype([&](auto &archetype){
+		typedef typename std::decay_t< decltype(archetype) >::Kind Kind;
+		for (auto &entry : archetype.entries) {
+			if (entry.reached) continue;
+
+			glm::vec2 obj_pos = glm::vec2(entry.at);
+			glm::vec2 min = glm::max(player_at, obj_pos);
+			glm::vec2 max = glm::min(player_at + glm::vec2(8, 8), obj_pos + glm::vec2(8, 8));
+
+			//if no overlap, no collision:
+			if (min.x > max.x || min.y > max.y) continue;
+
+			if (max.x - min.x > max.y - min.y) {
+				entry.reached = true;
+				events |= Kind::Events;
+			}
+		}
+	});
+	return events;
+}
+
+void ObjectStore::draw(glm::vec2 const &player_at, SpriteTable const &sprite_table, SpriteAllocator *sprites_) const {
+	assert(sprites_);
+	auto &sprites = *sprites_;
+	for_each_archetype([&](auto const &archetype){
+		typedef typename std::decay_t< decltype(archetype) >::Kind Kind;
+		for (auto const &entry : archetype.entries) {
+			float distance = glm::distance(glm::vec2(entry.at), player_at);
+			SpriteId id = Kind::Hidden;
+			if (entry.reached) id = Kind::Shown;
+			uint8_t attributes = 0;
+			// If not reached and player not close enough, draw behind background (not "illuminated")
+			if (!entry.reached && distance > 50) {
+				attributes |= (1 << 7);
+			}
+			sprite_table.add(&sprites, glm::ivec2(entry.at), id, attributes, distance);
+		}
+	});
+}
+
+void ObjectStore::reset_after_explosion() {
+	for_each_archetype([](auto &archetype){
+		typedef typename std::decay_t< decltype(archetype) >::Kind Kind;
+		if (!Kind::ResetOnExplode) return;
+		for (auto &entry : archetype.entries) {
+			entry.reached = false;
+		}
+	});
+}
+
+bool ObjectStore::complete() const {
+	bool any = false; //some CompletesOnAny object was reached
+	bool all = true; //every CompletesOnAll object was reached
+	for_each_archetype([&](auto const &archetype){
+		typedef typename std::decay_t< decltype(archetype) >::Kind Kind;
+		if (Kind::Completion == CompletesNever) return;
+		for (auto const &entry : archetype.entries) {
+			if (Kind::Completion == CompletesOnAny) any = any || entry.reached;
+			if (Kind::Completion == CompletesOnAll) all = all && entry.reached;
+		}
+	});
+	return any || all;
+}
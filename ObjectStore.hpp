@@ -0,0 +1,119 @@
+#pragma once
+
+/*
+ * ObjectStore -- the objects in a room, stored by kind ("archetype").
+ *
+ * Every kind of object (torch, chest with a key, chest with a bomb) lives in its own
+ * contiguous array, and each system (collide, draw, reset, complete) runs over one
+ * array at a time with that kind's behavior fixed at compile time by its Kind struct.
+ * So the per-frame loops never branch on the object's type.
+ *
+ * To add a new kind of object:
+ *  - write a Kind struct like the ones below (its Type is the obj_type it holds),
+ *  - and add an Archetype< NewKind > member to ObjectStore and list it in for_each_archetype().
+ * (import() sorts objects into archetypes by each Kind's Type, so it needs no changes.)
+ *
+ */
+
+#include "Room.hpp"
+#include "SpriteAllocator.hpp"
+#include "SpriteTable.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+//Events that reaching an object can raise (returned by ObjectStore::collide):
+enum ObjectEvent : uint32_t {
+	ObjectEventNone = 0,
+	ObjectEventExplode = (1 << 0),
+};
+
+//How an archetype counts toward completing the room:
+enum ObjectCompletion : uint32_t {
+	CompletesNever, //doesn't matter
+	CompletesOnAny, //room is complete once any object of this kind is reached
+	CompletesOnAll, //room is complete once every object of this kind is reached
+};
+
+//Kinds (compile-time behavior for each archetype):
+// Type - obj_type value used in Room.hpp / the room PNGs
+// Hidden, Shown - sprite drawn before / after being reached
+// Events - ObjectEvent bits raised when reached
+// Completion - how this kind counts toward finishing the room
+// ResetOnExplode - whether a bomb going off un-reaches objects of this kind
+
+struct TorchKind {
+	static constexpr int Type = 0;
+	static constexpr SpriteId Hidden = SpriteUnlitTorch, Shown = SpriteLitTorch; //unlit torch, lit torch
+	static constexpr uint32_t Events = ObjectEventNone;
+	static constexpr ObjectCompletion Completion = CompletesOnAll;
+	static constexpr bool ResetOnExplode = true;
+};
+
+struct KeyKind {
+	static constexpr int Type = 1;
+	static constexpr SpriteId Hidden = SpriteChest, Shown = SpriteKey; //chest, key
+	static constexpr uint32_t Events = ObjectEventNone;
+	static constexpr ObjectCompletion Completion = CompletesOnAny;
+	static constexpr bool ResetOnExplode = true;
+};
+
+struct BombKind {
+	static constexpr int Type = 2;
+	static constexpr SpriteId Hidden = SpriteChest, Shown = SpriteExplosion; //chest, explosion
+	static constexpr uint32_t Events = ObjectEventExplode;
+	static constexpr ObjectCompletion Completion = CompletesNever;
+	static constexpr bool ResetOnExplode = false; //keep showing explosions as a kindness to the player
+};
+
+template< typename Kind_ >
+struct Archetype {
+	typedef Kind_ Kind;
+	struct Entry {
+		glm::u8vec2 at = glm::u8vec2(0); //lower-left position in screen pixels
+		bool reached = false; //has been reached by player
+	};
+	std::vector< Entry > entries;
+};
+
+struct ObjectStore {
+	Archetype< TorchKind > torches;
+	Archetype< KeyKind > keys;
+	Archetype< BombKind > bombs;
+
+	//call f(archetype) for each of the archetypes above:
+	template< typename F >
+	void for_each_archetype(F &&f) {
+		f(torches);
+		f(keys);
+		f(bombs);
+	}
+	template< typename F >
+	void for_each_archetype(F &&f) const {
+		f(torches);
+		f(keys);
+		f(bombs);
+	}
+
+	//replace contents with the objects from a room:
+	// (objects of unknown type are ignored)
+	void import(std::vector< Object > const &objects);
+
+	//----- systems -----
+
+	//mark objects that the player (an 8x8 box at player_at) overlaps as reached:
+	// returns the ObjectEvent bits raised by newly-reached objects
+	uint32_t collide(glm::vec2 const &player_at);
+
+	//queue a sprite for every object, prioritized by distance to the player:
+	// (un-reached objects far from the player are drawn behind the background)
+	// sprite_table gives the tiles + attributes for each SpriteId (read from tiles.bin)
+	void draw(glm::vec2 const &player_at, SpriteTable const &sprite_table, SpriteAllocator *sprites) const;
+
+	//un-reach every object whose Kind has ResetOnExplode:
+	void reset_after_explosion();
+
+	//is the room finished?
+	bool complete() const;
+};
@@ -4,14 +4,19 @@
 #include "GL.hpp"
 #include "gl_compile_program.hpp"
 #include "gl_errors.hpp"
+#include "gl_state.hpp"
+#include "PPUStream.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
 
 #include <vector>
+#include <algorithm>
+#include <cstring>
 
 //In order to implement the PPU466 on modern graphics hardware, a fancy, special purpose tile-drawing shader is used:
 struct PPUTileProgram {
-	PPUTileProgram();
+	static GLProgramBuild start(); //start compiling
+	PPUTileProgram(GLProgramBuild const &build); //finish compiling and look up locations
 	~PPUTileProgram();
 
 	GLuint program = 0;
@@ -23,6 +28,7 @@ struct PPUTileProgram {
 
 	//Uniform (per-invocation variable) locations:
 	GLuint OBJECT_TO_CLIP_mat4 = -1U;
+	GLuint OFFSET_vec2 = -1U;
 
 	//Textures bindings:
 	//TEXTURE0 - the tile table (as a 128x128 R8UI texture)
@@ -30,7 +36,13 @@ struct PPUTileProgram {
 };
 
 //Initialize tile program and associated buffers:
-Load< PPUTileProgram > tile_program(LoadTagEarly); //will 'new PPUTileProgram()' by default
+// (the driver compiles the tile program in the background while everything else loads, if it can)
+Load< GLProgramBuild > tile_program_build(LoadOnGL, [](){
+	return new GLProgramBuild(PPUTileProgram::start());
+});
+Load< PPUTileProgram > tile_program(LoadOnGL, [](){
+	return new PPUTileProgram(*tile_program_build);
+}, { LoadAfter(tile_program_build, [](){ return gl_program_ready(*tile_program_build); }) });
 
 //PPU data is streamed to the GPU (read: uploaded 'just in time') using a few buffers:
 struct PPUDataStream {
@@ -54,14 +66,30 @@ struct PPUDataStream {
 	//vertex array object that maps tile program attributes to vertex storage:
 	GLuint vertex_buffer_for_tile_program = 0;
 
+	//vertex buffer that keeps the background tiles between frames:
+	// (one quad -- six vertices -- per background entry, in row-major order)
+	GLuint background_buffer = 0;
+
+	//vertex array object that maps tile program attributes to background storage:
+	GLuint background_buffer_for_tile_program = 0;
+
+	//the PPU466 whose background is currently stored in background_buffer:
+	// (the buffer is shared, so drawing a different PPU466 forces a full rebuild)
+	mutable PPU466 const *background_owner = nullptr;
+
 	//texture object that will store tile table:
 	GLuint tile_tex = 0;
 
+	//copy of the tile table currently stored in tile_tex (and which PPU466 it came from):
+	// (only rows of the texture holding changed tiles are re-uploaded)
+	mutable std::array< PPU466::Tile, 16 * 16 > uploaded_tiles;
+	mutable PPU466 const *tiles_owner = nullptr;
+
 	//texture object that will store palette table:
 	GLuint palette_tex = 0;
 };
 
-Load< PPUDataStream > data_stream(LoadTagDefault);
+Load< PPUDataStream > data_stream(LoadOnGL, new_T< PPUDataStream >, { tile_program }); //(uses tile_program's attribute locations)
 
 //-------------------------------------------------------------------
 
@@ -84,23 +112,96 @@ PPU466::PPU466() {
 			| (i % palette_table.size()) //cycle through all tiles
 		);
 	}
+	mark_background_dirty();
+}
+
+void PPU466::set_background(uint32_t x, uint32_t y, uint16_t value) {
+	assert(x < BackgroundWidth && y < BackgroundHeight);
+	uint16_t &entry = background[x + BackgroundWidth * y];
+	if (entry == value) return;
+	entry = value;
+	mark_background_dirty(glm::uvec2(x, y), glm::uvec2(x + 1, y + 1));
+}
+
+void PPU466::mark_background_dirty() {
+	background_dirty.clear();
+	mark_background_dirty(glm::uvec2(0, 0), glm::uvec2(BackgroundWidth, BackgroundHeight));
+}
+
+void PPU466::mark_background_dirty(glm::uvec2 const &min, glm::uvec2 const &max) {
+	DirtyRect rect;
+	rect.min = glm::min(min, glm::uvec2(BackgroundWidth, BackgroundHeight));
+	rect.max = glm::min(max, glm::uvec2(BackgroundWidth, BackgroundHeight));
+	if (rect.min.x >= rect.max.x || rect.min.y >= rect.max.y) return;
+
+	//merge with any rectangles that this one overlaps or touches:
+	for (auto r = background_dirty.begin(); r != background_dirty.end(); ) {
+		if (rect.min.x <= r->max.x && r->min.x <= rect.max.x
+		 && rect.min.y <= r->max.y && r->min.y <= rect.max.y) {
+			rect.min = glm::min(rect.min, r->min);
+			rect.max = glm::max(rect.max, r->max);
+			background_dirty.erase(r);
+			//the grown rectangle may now touch ones that were already checked:
+			r = background_dirty.begin();
+		} else {
+			++r;
+		}
+	}
+	background_dirty.emplace_back(rect);
+
+	//too many rectangles? just rebuild their bounding box:
+	if (background_dirty.size() > MaxDirtyRects) {
+		DirtyRect bounds = background_dirty[0];
+		for (auto const &r : background_dirty) {
+			bounds.min = glm::min(bounds.min, r.min);
+			bounds.max = glm::max(bounds.max, r.max);
+		}
+		background_dirty.assign(1, bounds);
+	}
+}
+
+//helper to put a single tile somewhere on the screen:
+// (flip_x / flip_y mirror the tile by swapping which edges of the tile image map to which edges of the quad)
+static void draw_tile(std::vector< PPUDataStream::Vertex > &triangle_strip, glm::ivec2 const &lower_left, uint8_t tile_index, uint8_t palette_index, bool flip_x = false, bool flip_y = false) {
+	//convert tile index to lower-left pixel coordinate in tile image:
+	glm::ivec2 tile_coord = glm::ivec2((tile_index % 16)*8, (tile_index / 16)*8);
+
+	//tile image coordinates of the quad's left/right and bottom/top edges:
+	const int32_t l = tile_coord.x + (flip_x ? 8 : 0);
+	const int32_t r = tile_coord.x + (flip_x ? 0 : 8);
+	const int32_t b = tile_coord.y + (flip_y ? 8 : 0);
+	const int32_t t = tile_coord.y + (flip_y ? 0 : 8);
+
+	//build a quad as a (very short) triangle strip that starts and ends with degenerate triangles:
+	triangle_strip.emplace_back(glm::ivec2(lower_left.x+0, lower_left.y+0), glm::ivec2(l, b), palette_index);
+	triangle_strip.emplace_back(triangle_strip.back());
+	triangle_strip.emplace_back(glm::ivec2(lower_left.x+0, lower_left.y+8), glm::ivec2(l, t), palette_index);
+	triangle_strip.emplace_back(glm::ivec2(lower_left.x+8, lower_left.y+0), glm::ivec2(r, b), palette_index);
+	triangle_strip.emplace_back(glm::ivec2(lower_left.x+8, lower_left.y+8), glm::ivec2(r, t), palette_index);
+	triangle_strip.emplace_back(triangle_strip.back());
 }
 
-void PPU466::draw(glm::uvec2 const &drawable_size) const {
+void PPU466::draw(glm::uvec2 const &drawable_size) {
+	//record this frame, if a recording is running: (just copies the state; see PPUStream.hpp)
+	if (PPUStreamWriter::current) PPUStreamWriter::current->record(*this);
+
+	//state changes go through gl_state(), which drops the ones that don't change anything:
+	GLState &gl = gl_state();
+
 	//this code does screen scaling by manipulating the viewport, so save old values:
-	GLint old_viewport[4];
-	glGetIntegerv(GL_VIEWPORT, old_viewport);
+	// (from gl_state()'s copy, so no glGet round trip)
+	glm::ivec4 old_viewport = gl.get_viewport();
 
 	//draw to whole drawable:
-	glViewport(0,0,drawable_size.x,drawable_size.y);
+	gl.viewport(glm::ivec4(0, 0, drawable_size.x, drawable_size.y));
 
 	//background gets background color:
-	glClearColor(
+	gl.clear_color(glm::vec4(
 		background_color.r / 255.0f, 
 		background_color.g / 255.0f, 
 		background_color.b / 255.0f,
 		1.0f
-	);
+	));
 	glClear(GL_COLOR_BUFFER_BIT);
 
 	//set up screen scaling:
@@ -117,82 +218,35 @@ void PPU466::draw(glm::uvec2 const &drawable_size) const {
 			(int32_t(drawable_size.x) - scale * int32_t(ScreenWidth)) / 2,
 			(int32_t(drawable_size.y) - scale * int32_t(ScreenHeight)) / 2
 		);
-		glViewport(lower_left.x, lower_left.y, scale * ScreenWidth, scale * ScreenHeight);
+		gl.viewport(glm::ivec4(lower_left.x, lower_left.y, scale * ScreenWidth, scale * ScreenHeight));
 	}
 
-	//build triangle strip representing background and sprites:
+	//build triangle strip representing sprites:
+	// (the background lives in its own buffer and is updated below)
 
-	constexpr uint32_t TristripSize = uint32_t(6 * (BackgroundWidth * BackgroundHeight + decltype(sprites)().size()));
+	constexpr uint32_t TristripSize = uint32_t(6 * decltype(sprites)().size());
 	std::vector< PPUDataStream::Vertex > triangle_strip;
 	triangle_strip.reserve(TristripSize);
 
-	//helper to put a single tile somewhere on the screen:
-	auto draw_tile = [&triangle_strip](glm::ivec2 const &lower_left, uint8_t tile_index, uint8_t palette_index){
-		//convert tile index to lower-left pixel coordinate in tile image:
-		glm::ivec2 tile_coord = glm::ivec2((tile_index % 16)*8, (tile_index / 16)*8);
-
-		//build a quad as a (very short) triangle strip that starts and ends with degenerate triangles:
-		triangle_strip.emplace_back(glm::ivec2(lower_left.x+0, lower_left.y+0), glm::ivec2(tile_coord.x+0, tile_coord.y+0), palette_index);
-		triangle_strip.emplace_back(triangle_strip.back());
-		triangle_strip.emplace_back(glm::ivec2(lower_left.x+0, lower_left.y+8), glm::ivec2(tile_coord.x+0, tile_coord.y+8), palette_index);
-		triangle_strip.emplace_back(glm::ivec2(lower_left.x+8, lower_left.y+0), glm::ivec2(tile_coord.x+8, tile_coord.y+0), palette_index);
-		triangle_strip.emplace_back(glm::ivec2(lower_left.x+8, lower_left.y+8), glm::ivec2(tile_coord.x+8, tile_coord.y+8), palette_index);
-		triangle_strip.emplace_back(triangle_strip.back());
-	};
-
 	//helper to draw the sprite list (used because we need to draw the 'behind' sprites, then the background, then the 'front' sprites:
-	auto draw_sprites = [this,&draw_tile](uint8_t priority) {
+	auto draw_sprites = [this,&triangle_strip](uint8_t priority) {
 		for (auto const &sprite : sprites) {
 			if ((sprite.attributes & 0x80) != priority) continue;
 			draw_tile(
+				triangle_strip,
 				glm::ivec2(sprite.x, sprite.y),
 				sprite.index,
-				sprite.attributes & 0x07 //just the palette index part
+				sprite.attributes & 0x07, //just the palette index part
+				(sprite.attributes & 0x08) != 0, //flip x
+				(sprite.attributes & 0x10) != 0 //flip y
 			);
 		}
 	};
 
 	draw_sprites(0x80); //draw sprites with priority == 1 ('behind' sprites)
 
-	{ //draw the background:
-		//To simulate the 'infinite tiling' behavior this code draws the background as four screen-sized chunks,
-		// each of which is drawn at an offset that causes it to overlap the screen.
-
-		static_assert(BackgroundWidth * 8 == ScreenWidth * 2, "Background should be exactly twice the screen width.");
-		static_assert(BackgroundHeight * 8 == ScreenHeight * 2, "Background should be exactly twice the screen height.");
-
-		for (int32_t chunk_y : {0, int32_t(ScreenHeight)}) {
-			for (int32_t chunk_x : {0, int32_t(ScreenWidth)}) {
-				//position of the lower-left corner of the chunk:
-				glm::ivec2 pos = glm::ivec2(chunk_x, chunk_y) + background_position;
-
-				constexpr int32_t BackgroundWidthPixels = int32_t(BackgroundWidth) * 8;
-				constexpr int32_t BackgroundHeightPixels = int32_t(BackgroundHeight) * 8;
-
-				//reduce to (-BackgroundWidthPixels,0] x (-BackgroundHeightPixels,0]:
-				pos.x = ((pos.x % BackgroundWidthPixels) - BackgroundWidthPixels) % BackgroundWidthPixels;
-				pos.y = ((pos.y % BackgroundHeightPixels) - BackgroundHeightPixels) % BackgroundHeightPixels;
-
-				//move chunk if it doesn't overlap the screen:
-				if (pos.x + int32_t(ScreenWidth) <= 0) pos.x += BackgroundWidthPixels;
-				if (pos.y + int32_t(ScreenHeight) <= 0) pos.y += BackgroundHeightPixels;
-
-				int32_t ox = chunk_x / 8;
-				int32_t oy = chunk_y / 8;
-				for (int32_t y = 0; y < int32_t(BackgroundHeight)/2; ++y) {
-					for (int32_t x = 0; x < int32_t(BackgroundWidth)/2; ++x) {
-						uint16_t info = background[(x + ox) + BackgroundWidth * (y + oy)];
-						draw_tile(
-							glm::ivec2(pos.x + 8*x, pos.y + 8*y),
-							info & 0xff, //extract tile index bits
-							(info >> 8) & 0x07 //extract palette index bits
-						);
-					}
-				}
-
-			}
-		}
-	}
+	//the background gets drawn between the two groups of sprites:
+	const GLsizei behind_size = GLsizei(triangle_strip.size());
 
 	draw_sprites(0x00); //draw sprites with priority == 0 ('in front' sprites)
 
@@ -203,53 +257,116 @@ void PPU466::draw(glm::uvec2 const &drawable_size) const {
 
 	{ //upload palette texture:
 		static_assert(sizeof(palette_table) == 4 * 4 * decltype(palette_table)().size(), "palette table is packed");
-		glBindTexture(GL_TEXTURE_2D, data_stream->palette_tex);
+		//(on the unit it's drawn from, so it stays bound for drawing)
+		gl.bind_texture_2d(1, data_stream->palette_tex);
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 4, GLsizei(palette_table.size()), 0, GL_RGBA, GL_UNSIGNED_BYTE, palette_table.data());
-		glBindTexture(GL_TEXTURE_2D, 0);
 	}
 
-	{ //build + upload tile table texture:
-		//interpret tiles and build a 128 x 128 index texture:
-		static std::array< uint8_t, 128 * 128 > data;
-		for (uint32_t i = 0; i < tile_table.size(); ++i) {
-			Tile const &tile = tile_table[i];
-
-			//location of tile in the texture:
-			uint32_t ox = (i % 16) * 8;
-			uint32_t oy = (i / 16) * 8;
-
-			//copy tile indices into texture:
-			for (uint32_t y = 0; y < 8; ++y) {
-				for (uint32_t x = 0; x < 8; ++x) {
-					data[ox+x + 128 * (oy+y)] =
-						  ((tile.bit0[y] >> x) & 1)
-						| ((tile.bit1[y] >> x) & 1) << 1;
+	{ //build + upload the rows of the tile table texture that changed:
+		//find the range of 16-tile rows [row_begin,row_end) holding tiles that differ from the last upload:
+		uint32_t row_begin = 16;
+		uint32_t row_end = 0;
+		if (data_stream->tiles_owner != this) {
+			row_begin = 0;
+			row_end = 16;
+			data_stream->tiles_owner = this;
+		} else {
+			static_assert(sizeof(tile_table) == 16 * 16 * sizeof(Tile), "tile table is packed");
+			for (uint32_t row = 0; row < 16; ++row) {
+				if (std::memcmp(&tile_table[row * 16], &data_stream->uploaded_tiles[row * 16], 16 * sizeof(Tile)) != 0) {
+					row_begin = std::min(row_begin, row);
+					row_end = row + 1;
 				}
 			}
 		}
 
-		glBindTexture(GL_TEXTURE_2D, data_stream->tile_tex);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_R8UI, 128, 128, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, data.data());
-		glBindTexture(GL_TEXTURE_2D, 0);
+		if (row_begin < row_end) {
+			//interpret tiles and build (part of) a 128 x 128 index texture:
+			static std::array< uint8_t, 128 * 128 > data;
+			for (uint32_t i = row_begin * 16; i < row_end * 16; ++i) {
+				Tile const &tile = tile_table[i];
+
+				//location of tile in the texture:
+				uint32_t ox = (i % 16) * 8;
+				uint32_t oy = (i / 16) * 8;
+
+				//copy tile indices into texture:
+				for (uint32_t y = 0; y < 8; ++y) {
+					for (uint32_t x = 0; x < 8; ++x) {
+						data[ox+x + 128 * (oy+y)] =
+							  ((tile.bit0[y] >> x) & 1)
+							| ((tile.bit1[y] >> x) & 1) << 1;
+					}
+				}
+			}
+			std::copy(tile_table.begin() + row_begin * 16, tile_table.begin() + row_end * 16, data_stream->uploaded_tiles.begin() + row_begin * 16);
+
+			gl.bind_texture_2d(0, data_stream->tile_tex);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, GLint(row_begin * 8), 128, GLsizei((row_end - row_begin) * 8), GL_RED_INTEGER, GL_UNSIGNED_BYTE, data.data() + 128 * (row_begin * 8));
+		}
 	}
 
 	{ //upload vertex data:
-		glBindBuffer(GL_ARRAY_BUFFER, data_stream->vertex_buffer);
+		gl.bind_array_buffer(data_stream->vertex_buffer);
 		glBufferData(GL_ARRAY_BUFFER, sizeof(decltype(triangle_strip[0])) * triangle_strip.size(), triangle_strip.data(), GL_STREAM_DRAW);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	{ //rebuild + upload only the background tiles that changed:
+		if (data_stream->background_owner != this) {
+			mark_background_dirty();
+			data_stream->background_owner = this;
+		}
+
+		static std::vector< PPUDataStream::Vertex > tiles; //scratch space, reused between frames
+
+		//helper to rebuild + upload a run of background entries [begin,end) (in row-major order):
+		auto upload_span = [this](uint32_t begin, uint32_t end) {
+			tiles.clear();
+			for (uint32_t i = begin; i < end; ++i) {
+				uint16_t info = background[i];
+				draw_tile(
+					tiles,
+					glm::ivec2(8 * (i % BackgroundWidth), 8 * (i / BackgroundWidth)),
+					info & 0xff, //extract tile index bits
+					(info >> 8) & 0x07, //extract palette index bits
+					(info & 0x0800) != 0, //flip x
+					(info & 0x1000) != 0 //flip y
+				);
+			}
+			glBufferSubData(GL_ARRAY_BUFFER,
+				GLintptr(begin * 6 * sizeof(PPUDataStream::Vertex)),
+				GLsizeiptr(tiles.size() * sizeof(PPUDataStream::Vertex)),
+				tiles.data()
+			);
+		};
+
+		if (!background_dirty.empty()) {
+			gl.bind_array_buffer(data_stream->background_buffer);
+			for (auto const &rect : background_dirty) {
+				if (rect.min.x == 0 && rect.max.x == BackgroundWidth) {
+					//full-width rectangles are one contiguous run:
+					upload_span(BackgroundWidth * rect.min.y, BackgroundWidth * rect.max.y);
+				} else {
+					for (uint32_t y = rect.min.y; y < rect.max.y; ++y) {
+						upload_span(rect.min.x + BackgroundWidth * y, rect.max.x + BackgroundWidth * y);
+					}
+				}
+			}
+			background_dirty.clear();
+		}
 	}
 
 	//set up the pipeline:
 	// set blending function for output fragments:
-	glEnable(GL_BLEND);
-	glBlendEquation(GL_FUNC_ADD);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	gl.blend(true);
+	gl.blend_equation(GL_FUNC_ADD);
+	gl.blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
 	// set the shader programs:
-	glUseProgram(tile_program->program);
+	gl.use_program(tile_program->program);
 
 	// configure attribute streams:
-	glBindVertexArray(data_stream->vertex_buffer_for_tile_program);
+	gl.bind_vertex_array(data_stream->vertex_buffer_for_tile_program);
 
 	// set uniforms for shader programs:
 	{ //set matrix to transform [0,ScreenWidth]x[0,ScreenHeight] -> [-1,1]x[-1,1]:
@@ -264,27 +381,48 @@ void PPU466::draw(glm::uvec2 const &drawable_size) const {
 	}
 
 	// bind texture units to proper texture objects:
-	glActiveTexture(GL_TEXTURE1);
-	glBindTexture(GL_TEXTURE_2D, data_stream->palette_tex);
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, data_stream->tile_tex);
+	gl.bind_texture_2d(1, data_stream->palette_tex);
+	gl.bind_texture_2d(0, data_stream->tile_tex);
 
-	//now that the pipeline is configured, trigger drawing of triangle strip:
-	glDrawArrays(GL_TRIANGLE_STRIP, 0, GLsizei(triangle_strip.size()));
+	//now that the pipeline is configured, trigger drawing of 'behind' sprites:
+	glUniform2f(tile_program->OFFSET_vec2, 0.0f, 0.0f);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, behind_size);
 
-	//return state to default:
-	glActiveTexture(GL_TEXTURE1);
-	glBindTexture(GL_TEXTURE_2D, 0);
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	{ //draw the background:
+		//To simulate the 'infinite tiling' behavior this code draws the whole background
+		// at each of the (up to four) offsets that cause it to overlap the screen.
 
-	glBindVertexArray(0);
-	glUseProgram(0);
+		static_assert(BackgroundWidth * 8 == ScreenWidth * 2, "Background should be exactly twice the screen width.");
+		static_assert(BackgroundHeight * 8 == ScreenHeight * 2, "Background should be exactly twice the screen height.");
+
+		constexpr int32_t BackgroundWidthPixels = int32_t(BackgroundWidth) * 8;
+		constexpr int32_t BackgroundHeightPixels = int32_t(BackgroundHeight) * 8;
 
-	glDisable(GL_BLEND);
+		//reduce to (-BackgroundWidthPixels,0] x (-BackgroundHeightPixels,0]:
+		glm::ivec2 pos = background_position;
+		pos.x = ((pos.x % BackgroundWidthPixels) - BackgroundWidthPixels) % BackgroundWidthPixels;
+		pos.y = ((pos.y % BackgroundHeightPixels) - BackgroundHeightPixels) % BackgroundHeightPixels;
+
+		gl.bind_vertex_array(data_stream->background_buffer_for_tile_program);
+		for (int32_t oy : {pos.y, pos.y + BackgroundHeightPixels}) {
+			for (int32_t ox : {pos.x, pos.x + BackgroundWidthPixels}) {
+				//skip copies that don't overlap the screen:
+				if (ox >= int32_t(ScreenWidth) || oy >= int32_t(ScreenHeight)) continue;
+
+				glUniform2f(tile_program->OFFSET_vec2, float(ox), float(oy));
+				glDrawArrays(GL_TRIANGLE_STRIP, 0, GLsizei(6 * BackgroundWidth * BackgroundHeight));
+			}
+		}
+		gl.bind_vertex_array(data_stream->vertex_buffer_for_tile_program);
+	}
 
-	//also restore viewport, since earlier scaling code messed with it:
-	glViewport(old_viewport[0], old_viewport[1], old_viewport[2], old_viewport[3]);
+	//...and finally the 'in front' sprites:
+	glUniform2f(tile_program->OFFSET_vec2, 0.0f, 0.0f);
+	glDrawArrays(GL_TRIANGLE_STRIP, behind_size, GLsizei(triangle_strip.size()) - behind_size);
+
+	//bindings and blending are left as they are (the next frame will probably want them again),
+	// but restore viewport, since earlier scaling code messed with it:
+	gl.viewport(old_viewport);
 
 	GL_ERRORS();
 }
@@ -292,18 +430,19 @@ void PPU466::draw(glm::uvec2 const &drawable_size) const {
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-PPUTileProgram::PPUTileProgram() {
-	program = gl_compile_program(
+GLProgramBuild PPUTileProgram::start() {
+	return gl_start_program(
 		//vertex shader:
 		"#version 330\n"
 		"uniform mat4 OBJECT_TO_CLIP;\n"
+		"uniform vec2 OFFSET;\n"
 		"in vec4 Position;\n"
 		"in ivec2 TileCoord;\n"
 		"in int Palette;\n"
 		"out vec2 tileCoord;\n"
 		"flat out int palette;\n"
 		"void main() {\n"
-		"	gl_Position = OBJECT_TO_CLIP * Position;\n"
+		"	gl_Position = OBJECT_TO_CLIP * (Position + vec4(OFFSET, 0.0, 0.0));\n"
 		"	tileCoord = TileCoord;\n"
 		"	palette = Palette;\n"
 		"}\n"
@@ -323,6 +462,10 @@ PPUTileProgram::PPUTileProgram() {
 		//"	fragColor = texelFetch(PALETTE_TABLE, ivec2(int(gl_FragCoord.x) % textureSize(PALETTE_TABLE,0).x, int(gl_FragCoord.y) % textureSize(PALETTE_TABLE,0).y), 0);\n"
 		"}\n"
 	);
+}
+
+PPUTileProgram::PPUTileProgram(GLProgramBuild const &build) {
+	program = gl_finish_program(build);
 
 	//look up the locations of vertex attributes:
 	Position_vec2 = glGetAttribLocation(program, "Position");
@@ -331,6 +474,7 @@ PPUTileProgram::PPUTileProgram() {
 
 	//look up the locations of uniforms:
 	OBJECT_TO_CLIP_mat4 = glGetUniformLocation(program, "OBJECT_TO_CLIP");
+	OFFSET_vec2 = glGetUniformLocation(program, "OFFSET");
 
 	GLuint TILE_TABLE_usampler2D = glGetUniformLocation(program, "TILE_TABLE");
 	GLuint PALETTE_TABLE_sampler2D = glGetUniformLocation(program, "PALETTE_TABLE");
@@ -341,6 +485,8 @@ PPUTileProgram::PPUTileProgram() {
 	glUniform1i(PALETTE_TABLE_sampler2D, 1);
 	glUseProgram(0);
 
+	gl_state().forget(); //(the program was bound directly, above)
+
 	GL_ERRORS();
 }
 
@@ -349,6 +495,7 @@ PPUTileProgram::~PPUTileProgram() {
 		glDeleteProgram(program);
 		program = 0;
 	}
+	gl_state().forget(); //(deleting a bound object unbinds it)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -357,48 +504,59 @@ PPUTileProgram::~PPUTileProgram() {
 //PPU data is streamed to the GPU (read: uploaded 'just in time') using a few buffers:
 PPUDataStream::PPUDataStream() {
 
-	//vertex_buffer_for_tile_program is a vertex array object that tells the GPU the layout of data in vertex_buffer:
-	glGenVertexArrays(1, &vertex_buffer_for_tile_program);
-	glBindVertexArray(vertex_buffer_for_tile_program);
+	//helper that sets up a vertex array object telling the GPU the layout of data in a vertex buffer:
+	auto describe_vertices = [](GLuint vao, GLuint buffer) {
+		glBindVertexArray(vao);
+		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+		//Notice how this binding is attaching an integer input to a floating point attribute:
+		glVertexAttribPointer(
+			tile_program->Position_vec2, //attribute
+			2, //size
+			GL_INT, //type
+			GL_FALSE, //normalized
+			sizeof(Vertex), //stride
+			(GLbyte *)0 + offsetof(Vertex, Position) //offset
+		);
+		glEnableVertexAttribArray(tile_program->Position_vec2);
+
+		//the "I" variant binds to an integer attribute:
+		glVertexAttribIPointer(
+			tile_program->TileCoord_ivec2, //attribute
+			2, //size
+			GL_INT, //type
+			sizeof(Vertex), //stride
+			(GLbyte *)0 + offsetof(Vertex, TileCoord) //offset
+		);
+		glEnableVertexAttribArray(tile_program->TileCoord_ivec2);
+
+		//I could have stored the Palette as another entry in the TileCoord attribute stream
+		glVertexAttribIPointer(
+			tile_program->Palette_int, //attribute
+			1, //size
+			GL_UNSIGNED_INT, //type
+			sizeof(Vertex), //stride
+			(GLbyte *)0 + offsetof(Vertex, Palette) //offset
+		);
+		glEnableVertexAttribArray(tile_program->Palette_int);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-	//vertex_buffer will (eventually) hold vertex data for drawing:
+		glBindVertexArray(0);
+	};
+
+	//vertex_buffer will (eventually) hold vertex data for drawing sprites:
 	glGenBuffers(1, &vertex_buffer);
-	glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
-
-	//Notice how this binding is attaching an integer input to a floating point attribute:
-	glVertexAttribPointer(
-		tile_program->Position_vec2, //attribute
-		2, //size
-		GL_INT, //type
-		GL_FALSE, //normalized
-		sizeof(Vertex), //stride
-		(GLbyte *)0 + offsetof(Vertex, Position) //offset
-	);
-	glEnableVertexAttribArray(tile_program->Position_vec2);
-
-	//the "I" variant binds to an integer attribute:
-	glVertexAttribIPointer(
-		tile_program->TileCoord_ivec2, //attribute
-		2, //size
-		GL_INT, //type
-		sizeof(Vertex), //stride
-		(GLbyte *)0 + offsetof(Vertex, TileCoord) //offset
-	);
-	glEnableVertexAttribArray(tile_program->TileCoord_ivec2);
-
-	//I could have stored the Palette as another entry in the TileCoord attribute stream
-	glVertexAttribIPointer(
-		tile_program->Palette_int, //attribute
-		1, //size
-		GL_UNSIGNED_INT, //type
-		sizeof(Vertex), //stride
-		(GLbyte *)0 + offsetof(Vertex, Palette) //offset
-	);
-	glEnableVertexAttribArray(tile_program->Palette_int);
+	glGenVertexArrays(1, &vertex_buffer_for_tile_program);
+	describe_vertices(vertex_buffer_for_tile_program, vertex_buffer);
 
+	//background_buffer holds one quad per background entry; it is allocated once and updated piecewise:
+	glGenBuffers(1, &background_buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, background_buffer);
+	glBufferData(GL_ARRAY_BUFFER, 6 * PPU466::BackgroundWidth * PPU466::BackgroundHeight * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-	glBindVertexArray(0);
+	glGenVertexArrays(1, &background_buffer_for_tile_program);
+	describe_vertices(background_buffer_for_tile_program, background_buffer);
 
 
 	glGenTextures(1, &tile_tex);
@@ -428,6 +586,7 @@ PPUDataStream::PPUDataStream() {
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 	glBindTexture(GL_TEXTURE_2D, 0);
 
+	gl_state().forget(); //(buffers and textures were bound directly, above)
 
 	GL_ERRORS();
 }
@@ -441,6 +600,14 @@ PPUDataStream::~PPUDataStream() {
 		glDeleteBuffers(1, &vertex_buffer);
 		vertex_buffer = 0;
 	}
+	if (background_buffer_for_tile_program != 0) {
+		glDeleteVertexArrays(1, &background_buffer_for_tile_program);
+		background_buffer_for_tile_program = 0;
+	}
+	if (background_buffer != 0) {
+		glDeleteBuffers(1, &background_buffer);
+		background_buffer = 0;
+	}
 	if (tile_tex != 0) {
 		glDeleteTextures(1, &tile_tex);
 		tile_tex = 0;
@@ -449,4 +616,5 @@ PPUDataStream::~PPUDataStream() {
 		glDeleteTextures(1, &palette_tex);
 		palette_tex = 0;
 	}
+	gl_state().forget(); //(deleting a bound object unbinds it)
 }
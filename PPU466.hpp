@@ -7,6 +7,7 @@
 
 #include <glm/glm.hpp>
 #include <array>
+#include <vector>
 
 struct PPU466 {
 	PPU466();
@@ -16,7 +17,8 @@ struct PPU466 {
 
 	//when you wish the PPU to draw, tell it so:
 	// pass the size of the current framebuffer in pixels so it knows how to scale itself
-	void draw(glm::uvec2 const &drawable_size) const;
+	// (drawing also uploads -- and clears -- the background dirty set; see below)
+	void draw(glm::uvec2 const &drawable_size);
 
 	//--------------------------------------------------------------
 	//Set the values below to control the PPU's drawing:
@@ -80,15 +82,43 @@ struct PPU466 {
 	//  each value in the grid gives:
 	//    - bits 0-7: tile table index
 	//    - bits 8-10: palette table index
-	//    - bits 11-15: unused, should be 0
+	//    - bit 11: flip tile horizontally
+	//    - bit 12: flip tile vertically
+	//    - bits 13-15: unused, should be 0
 	//
 	//  bits:  F E D C B A 9 8 7 6 5 4 3 2 1 0
-	//        |---------|-----|---------------|
-	//            ^        ^        ^-- tile index
-	//            |        '----------- palette index
-	//            '-------------------- unused (set to zero)
+	//        |-----|-|-|-----|---------------|
+	//           ^   ^ ^   ^        ^-- tile index
+	//           |   | |   '----------- palette index
+	//           |   | '--------------- flip x
+	//           |   '----------------- flip y
+	//           '--------------------- unused (set to zero)
 	std::array< uint16_t, BackgroundWidth * BackgroundHeight > background;
 
+	//Background Updates:
+	// The PPU keeps the background on the GPU between frames and only rebuilds
+	//  the tiles that have been marked as changed since the last draw.
+	//
+	// set_background() writes one entry and marks it dirty (if it changed):
+	void set_background(uint32_t x, uint32_t y, uint16_t value);
+	//
+	// if you write to 'background' directly, mark the tiles you touched:
+	//  (rectangle is [min,max) in tiles; it is clamped to the background)
+	void mark_background_dirty(glm::uvec2 const &min, glm::uvec2 const &max);
+	//  (...or just mark the whole thing, e.g. after authoring a new room)
+	void mark_background_dirty();
+	//
+	// The dirty set is a short list of rectangles; nearby rectangles are merged
+	//  and, if the list grows past MaxDirtyRects, it collapses to its bounding box:
+	enum : uint32_t {
+		MaxDirtyRects = 8
+	};
+	struct DirtyRect {
+		glm::uvec2 min; //lower-left tile (inclusive)
+		glm::uvec2 max; //upper-right tile (exclusive)
+	};
+	std::vector< DirtyRect > background_dirty;
+
 	//Background Position:
 	// The background's lower-left pixel can positioned anywhere
 	//   this can be used to "scroll the screen".
@@ -109,16 +139,21 @@ struct PPU466 {
 	//
 	//  the sprite 'attributes' byte gives:
 	//   bits:  7 6 5 4 3 2 1 0
-	//         |-|-------|-----|
-	//          ^    ^      ^
-	//          |    |      '---- palette index (bits 0-2)
-	//          |    '----------- unused (set to zero)
+	//         |-|---|-|-|-----|
+	//          ^  ^  ^ ^   ^
+	//          |  |  | |   '---- palette index (bits 0-2)
+	//          |  |  | '-------- flip x (bit 3)
+	//          |  |  '---------- flip y (bit 4)
+	//          |  '------------- unused (set to zero)
 	//          '---------------- priority bit (bit 7)
 	//
 	//  the 'priority bit' chooses whether to render the sprite
 	//   in front of (priority = 0) the background
 	//   or behind (priority = 1) the background
 	//
+	//  the 'flip' bits mirror the tile, so one tile table entry can serve
+	//   as (e.g.) both the left- and right-facing versions of a sprite
+	//
 	struct Sprite {
 		uint8_t x = 0; //x position. 0 is the left edge of the screen.
 		uint8_t y = 240; //y position. 0 is the bottom edge of the screen. >= 240 is off-screen
@@ -0,0 +1,157 @@
+#include "PPUStream.hpp"
+
+#include "Rewind.hpp"
+#include "read_write_chunk.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+static constexpr uint32_t PPUStreamVersion = 1;
+
+std::shared_ptr< PPUStreamWriter > PPUStreamWriter::current;
+
+PPUStreamWriter::PPUStreamWriter(std::string const &filename_, uint32_t key_interval_, uint32_t max_queued_)
+	: filename(filename_), file(filename_, std::ios::binary), key_interval(key_interval_), max_queued(max_queued_) {
+	if (!file) throw std::runtime_error("Failed to open '" + filename + "' for recording.");
+	if (key_interval == 0) key_interval = 1;
+	if (max_queued == 0) max_queued = 1;
+
+	std::vector< uint32_t > header{ PPUStreamVersion, key_interval };
+	write_chunk("ppuh", header, &file);
+
+	start = std::chrono::steady_clock::now();
+	writer = std::thread(&PPUStreamWriter::write_frames, this);
+}
+
+PPUStreamWriter::~PPUStreamWriter() {
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	changed.notify_all();
+	writer.join();
+}
+
+void PPUStreamWriter::record(PPU466 const &ppu) {
+	Frame frame;
+	frame.time = uint64_t(std::chrono::duration_cast< std::chrono::microseconds >(std::chrono::steady_clock::now() - start).count());
+
+	{ //wait for room in the queue, and grab a buffer to copy into:
+		std::unique_lock< std::mutex > lock(mutex);
+		changed.wait(lock, [this](){ return queued.size() < max_queued; });
+		if (!spare.empty()) {
+			frame.state = std::move(spare.back());
+			spare.pop_back();
+		}
+	}
+
+	//copying the state is all the encoding done on this thread:
+	frame.state.clear();
+	Rewind::save_ppu(ppu, &frame.state);
+
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		queued.emplace_back(std::move(frame));
+	}
+	changed.notify_all();
+	frames += 1;
+}
+
+void PPUStreamWriter::write_frames() {
+	std::vector< uint8_t > previous; //state of the last frame written
+	std::vector< uint8_t > delta;
+	std::vector< uint8_t > chunk;
+	uint32_t written = 0;
+	bool failed = false;
+
+	std::unique_lock< std::mutex > lock(mutex);
+	while (true) {
+		if (queued.empty()) {
+			if (quit) break;
+			changed.wait(lock);
+			continue;
+		}
+		Frame frame = std::move(queued.front());
+		queued.pop_front();
+		lock.unlock();
+		changed.notify_all(); //(there's room in the queue now)
+
+		if (!failed) {
+			chunk.resize(8);
+			std::memcpy(chunk.data(), &frame.time, 8);
+			if (written % key_interval == 0 || previous.size() != frame.state.size()) {
+				chunk.insert(chunk.end(), frame.state.begin(), frame.state.end());
+				write_chunk("ppuk", chunk, &file, ChunkZlib);
+				written = 0;
+			} else {
+				//(XOR is symmetric, so this is the delta that turns 'previous' into this frame)
+				Rewind::encode_delta(frame.state, previous, &delta);
+				chunk.insert(chunk.end(), delta.begin(), delta.end());
+				write_chunk("ppud", chunk, &file);
+			}
+			written += 1;
+			if (!file) {
+				//keep taking frames (so record() doesn't wait forever), but stop writing them:
+				std::cerr << "NOTE: failed to write to '" << filename << "'; the recording stops here." << std::endl;
+				failed = true;
+			}
+		}
+		std::swap(previous, frame.state);
+
+		lock.lock();
+		if (!frame.state.empty()) spare.emplace_back(std::move(frame.state));
+	}
+}
+
+//--------------------------------------
+
+PPUStreamReader::PPUStreamReader(std::string const &filename_) : filename(filename_), file(filename_, std::ios::binary) {
+	if (!file) throw std::runtime_error("Failed to open '" + filename + "'.");
+
+	std::vector< uint32_t > header;
+	read_chunk(file, "ppuh", &header);
+	if (header.size() < 2) throw std::runtime_error("'" + filename + "' has a truncated header.");
+	if (header[0] != PPUStreamVersion) {
+		throw std::runtime_error("'" + filename + "' is PPU stream version " + std::to_string(header[0]) + ", expected version " + std::to_string(PPUStreamVersion) + ".");
+	}
+}
+
+bool PPUStreamReader::read_frame() {
+	if (file.peek() == std::char_traits< char >::eof()) return false;
+
+	try {
+		char magic[4];
+		if (!file.read(magic, 4) || !file.seekg(-4, std::ios::cur)) throw std::runtime_error("frame is truncated");
+
+		std::vector< uint8_t > chunk;
+		if (std::string(magic, 4) == "ppuk") {
+			read_chunk(file, "ppuk", &chunk);
+			if (chunk.size() < 8) throw std::runtime_error("key frame is truncated");
+			state.assign(chunk.begin() + 8, chunk.end());
+			have_key = true;
+		} else if (std::string(magic, 4) == "ppud") {
+			read_chunk(file, "ppud", &chunk);
+			if (chunk.size() < 8) throw std::runtime_error("delta frame is truncated");
+			if (!have_key) throw std::runtime_error("delta frame before the first key frame");
+			std::vector< uint8_t > delta(chunk.begin() + 8, chunk.end());
+			Rewind::apply_delta(delta, &state);
+		} else {
+			throw std::runtime_error("unexpected '" + std::string(magic, 4) + "' chunk");
+		}
+
+		uint64_t microseconds;
+		std::memcpy(&microseconds, chunk.data(), 8);
+		time = double(microseconds) / 1e6;
+		frames += 1;
+		return true;
+	} catch (std::exception &e) {
+		std::cerr << "NOTE: '" << filename << "' ends at frame " << frames << " (" << e.what() << ")." << std::endl;
+		return false;
+	}
+}
+
+void PPUStreamReader::load(PPU466 *ppu) const {
+	size_t at = 0;
+	Rewind::load_ppu(state, &at, ppu);
+}
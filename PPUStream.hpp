@@ -0,0 +1,96 @@
+#pragma once
+
+/*
+ * PPUStream -- records what the PPU466 draws, every frame, as a lossless stream (and plays it back).
+ *
+ * Rather than pixels, each frame stores the PPU's state (palettes, tiles, background, sprites; ~12k),
+ *  which is everything the PPU draws from: played back, it draws exactly the same frames.
+ * Most frames are stored as a delta against the frame before (the XOR runs Rewind uses), with a whole
+ *  (zlib-compressed) key frame every so often so that a cut-off recording still plays up to the cut.
+ *
+ * PPUStreamWriter::current = std::make_shared< PPUStreamWriter >("recording.ppu"); //start recording
+ * PPUStreamWriter::current.reset(); //stop recording (writes whatever is still queued, then closes the file)
+ *
+ * While PPUStreamWriter::current is set, PPU466::draw() records every frame it draws.
+ * Recording copies the state into a bounded queue; a writer thread does the encoding and writing.
+ * Frames are never dropped: if the writer falls 'max_queued' frames behind, record() waits for it.
+ *
+ * PPUStreamReader reader("recording.ppu");
+ * while (reader.read_frame()) {
+ *     //(wait until reader.time)
+ *     reader.load(&ppu);
+ * }
+ *
+ * File format: chunks (see read_write_chunk.hpp), starting with a header:
+ *  "ppuh": |version (4 bytes)|key frame interval (4 bytes)|
+ * then a chunk per frame, each starting with |microseconds since recording started (8 bytes)|:
+ *  "ppuk": key frame -- followed by the PPU state (as Rewind::save_ppu writes it)
+ *  "ppud": delta frame -- followed by the Rewind::encode_delta that turns the previous frame's state into this one
+ */
+
+#include "PPU466.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct PPUStreamWriter {
+	//throws if 'filename' can't be opened:
+	PPUStreamWriter(std::string const &filename, uint32_t key_interval = 60, uint32_t max_queued = 120);
+	~PPUStreamWriter(); //writes everything queued, then closes the file
+
+	//queue a frame to be written: (waits if the writer thread is 'max_queued' frames behind)
+	void record(PPU466 const &ppu);
+
+	uint32_t frames = 0; //frames recorded so far
+
+	//the recording that PPU466::draw() records to (if any):
+	static std::shared_ptr< PPUStreamWriter > current;
+
+	//----- internals -----
+	std::string filename;
+	std::ofstream file;
+	uint32_t key_interval;
+	uint32_t max_queued;
+	std::chrono::steady_clock::time_point start;
+
+	struct Frame {
+		uint64_t time = 0; //microseconds since 'start'
+		std::vector< uint8_t > state;
+	};
+
+	std::mutex mutex; //guards everything below:
+	std::condition_variable changed; //signalled when a frame is queued or written (or when quitting)
+	std::deque< Frame > queued; //frames waiting to be written, oldest first
+	std::vector< std::vector< uint8_t > > spare; //written frames' buffers, for reuse
+	bool quit = false;
+
+	std::thread writer; //(declared last, so it starts after everything it uses)
+	void write_frames(); //(runs on 'writer')
+};
+
+struct PPUStreamReader {
+	//throws if 'filename' can't be read or isn't a PPU stream:
+	PPUStreamReader(std::string const &filename);
+
+	//read the next frame; returns false at the end of the stream (or at the first damaged frame):
+	bool read_frame();
+
+	//copy the last frame read into 'ppu':
+	void load(PPU466 *ppu) const;
+
+	double time = 0.0; //time of the last frame read (seconds since recording started)
+	uint32_t frames = 0; //frames read so far
+
+	//----- internals -----
+	std::string filename;
+	std::ifstream file;
+	std::vector< uint8_t > state; //last frame read
+	bool have_key = false; //(deltas mean nothing before the first key frame)
+};
@@ -1,11 +1,15 @@
 #include "PPU466.hpp"
+#include "SpriteAllocator.hpp"
 #include "Mode.hpp"
-#include "Room.hpp"
+#include "Simulation.hpp"
+#include "Rewind.hpp"
+#include "SpriteTable.hpp"
 
 #include <glm/glm.hpp>
 
 #include <vector>
 #include <deque>
+#include <memory>
 
 struct PlayMode : Mode {
 	PlayMode();
@@ -16,29 +20,38 @@ struct PlayMode : Mode {
 	virtual void update(float elapsed) override;
 	virtual void draw(glm::uvec2 const &drawable_size) override;
 
+	//write the current room's nametable into the PPU's background:
+	void author_background();
+
 	//----- game state -----
 
 	//input tracking:
 	struct Button {
 		uint8_t downs = 0;
 		uint8_t pressed = 0;
-	} left, right, down, up;
+	} left, right, down, up, rewind; //(rewind is backspace)
 
 	//some weird background animation:
 	float background_fade = 0.0f;
 
-	//player position:
-	glm::vec2 player_at = glm::vec2(0.0f);
+	//rooms, player, and objects (shared with the headless batch runner):
+	std::unique_ptr< Simulation > game;
+
+	//every tick of game + PPU state, for rewinding (hold backspace):
+	Rewind history;
 
 	//----- drawing handled by PPU466 -----
 
 	PPU466 ppu;
 
+	//tiles + attributes for each SpriteId (read from tiles.bin):
+	SpriteTable sprite_table;
+
+	//assigns room objects to the PPU's 64 sprites:
+	SpriteAllocator sprites;
+
 	bool draw_opponent = true;
 
-	int room_num = 0;
-	std::vector< Object > room; // Current room
-	std::vector< Object > room0;
-	std::vector< Object > room1;
-	std::vector< Object > room2;
+	//value of game->rooms_entered when the background was last authored:
+	uint32_t authored_rooms = 0;
 };
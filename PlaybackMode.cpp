@@ -0,0 +1,55 @@
+#include "PlaybackMode.hpp"
+
+#include <iostream>
+#include <stdexcept>
+
+PlaybackMode::PlaybackMode(std::string const &filename) : reader(filename) {
+	have_frame = reader.read_frame();
+	if (!have_frame) throw std::runtime_error("'" + filename + "' has no frames.");
+	//show the first frame right away:
+	reader.load(&ppu);
+	time = reader.time;
+	have_frame = reader.read_frame();
+}
+
+PlaybackMode::~PlaybackMode() {
+}
+
+bool PlaybackMode::handle_event(SDL_Event const &evt, glm::uvec2 const &window_size) {
+	if (evt.type == SDL_KEYDOWN) {
+		if (evt.key.keysym.sym == SDLK_SPACE) {
+			paused = !paused;
+			return true;
+		} else if (evt.key.keysym.sym == SDLK_RIGHT) {
+			step = true;
+			return true;
+		}
+	}
+	return false;
+}
+
+void PlaybackMode::update(float elapsed) {
+	if (!have_frame) return; //(keep showing the last frame)
+
+	if (paused) {
+		if (!step) return;
+		step = false;
+		time = reader.time; //(show exactly the next frame)
+	} else {
+		time += elapsed;
+	}
+
+	//catch up to 'time': (only the newest frame due gets drawn, but every frame is decoded, since they're deltas)
+	while (have_frame && reader.time <= time) {
+		reader.load(&ppu);
+		have_frame = reader.read_frame();
+	}
+
+	if (!have_frame) {
+		std::cout << "Played back " << reader.frames << " frames." << std::endl;
+	}
+}
+
+void PlaybackMode::draw(glm::uvec2 const &drawable_size) {
+	ppu.draw(drawable_size);
+}
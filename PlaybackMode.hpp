@@ -0,0 +1,34 @@
+#pragma once
+
+#include "PPU466.hpp"
+#include "Mode.hpp"
+#include "PPUStream.hpp"
+
+#include <glm/glm.hpp>
+
+#include <string>
+
+//plays back a recording of PPU output (see PPUStream.hpp), at the speed it was recorded:
+// (space pauses; right arrow steps one frame while paused)
+struct PlaybackMode : Mode {
+	PlaybackMode(std::string const &filename);
+	virtual ~PlaybackMode();
+
+	//functions called by main loop:
+	virtual bool handle_event(SDL_Event const &, glm::uvec2 const &window_size) override;
+	virtual void update(float elapsed) override;
+	virtual void draw(glm::uvec2 const &drawable_size) override;
+
+	//----- playback state -----
+
+	PPUStreamReader reader;
+	bool have_frame = false; //has 'reader' read a frame that hasn't been shown yet?
+
+	double time = 0.0; //seconds since the recording started
+	bool paused = false;
+	bool step = false; //show the next frame (while paused)
+
+	//----- drawing handled by PPU466 -----
+
+	PPU466 ppu;
+};
@@ -0,0 +1,268 @@
+#include "Rewind.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+//------ delta encoding ------
+//A delta turns a newer state into an older one:
+// | u32 size of older state | runs ... |
+//  where each run is:
+// | u16 unchanged bytes | u16 changed bytes | changed bytes (older XOR newer) |
+
+void Rewind::encode_delta(std::vector< uint8_t > const &older, std::vector< uint8_t > const &newer, std::vector< uint8_t > *delta_) {
+	auto &delta = *delta_;
+	delta.clear();
+
+	auto append = [&delta](void const *data, size_t size) {
+		delta.insert(delta.end(), reinterpret_cast< uint8_t const * >(data), reinterpret_cast< uint8_t const * >(data) + size);
+	};
+
+	uint32_t size = uint32_t(older.size());
+	append(&size, 4);
+
+	const size_t common = std::min(older.size(), newer.size());
+	auto changed = [&](size_t i) -> uint8_t {
+		return older[i] ^ (i < common ? newer[i] : 0);
+	};
+
+	size_t i = 0;
+	while (i < older.size()) {
+		//skip unchanged bytes (a word at a time where possible):
+		size_t start = i;
+		while (i + 8 <= common && std::memcmp(&older[i], &newer[i], 8) == 0 && i - start + 8 <= 0xffff) i += 8;
+		while (i < older.size() && changed(i) == 0 && i - start < 0xffff) ++i;
+		uint16_t zeros = uint16_t(i - start);
+
+		//collect changed bytes:
+		start = i;
+		while (i < older.size() && changed(i) != 0 && i - start < 0xffff) ++i;
+		uint16_t literals = uint16_t(i - start);
+
+		append(&zeros, 2);
+		append(&literals, 2);
+		for (size_t j = start; j < i; ++j) {
+			delta.emplace_back(changed(j));
+		}
+	}
+}
+
+void Rewind::apply_delta(std::vector< uint8_t > const &delta, std::vector< uint8_t > *state_) {
+	auto &state = *state_;
+	if (delta.size() < 4) throw std::runtime_error("Rewind delta is truncated.");
+
+	uint32_t size;
+	std::memcpy(&size, &delta[0], 4);
+	state.resize(size, 0);
+
+	size_t at = 0;
+	size_t i = 4;
+	while (i < delta.size()) {
+		if (i + 4 > delta.size()) throw std::runtime_error("Rewind delta is truncated.");
+		uint16_t zeros, literals;
+		std::memcpy(&zeros, &delta[i], 2);
+		std::memcpy(&literals, &delta[i+2], 2);
+		i += 4;
+		at += zeros;
+		if (at + literals > state.size() || i + literals > delta.size()) throw std::runtime_error("Rewind delta is corrupt.");
+		for (uint32_t j = 0; j < literals; ++j) {
+			state[at + j] ^= delta[i + j];
+		}
+		at += literals;
+		i += literals;
+	}
+}
+
+//------ state serialization ------
+
+template< typename T >
+static void write(std::vector< uint8_t > *to, T const &value) {
+	to->insert(to->end(), reinterpret_cast< uint8_t const * >(&value), reinterpret_cast< uint8_t const * >(&value) + sizeof(T));
+}
+
+template< typename T >
+static void read(std::vector< uint8_t > const &from, size_t *at, T *value) {
+	if (*at + sizeof(T) > from.size()) throw std::runtime_error("Rewind state is truncated.");
+	std::memcpy(value, &from[*at], sizeof(T));
+	*at += sizeof(T);
+}
+
+void Rewind::save_state(Simulation const &sim, PPU466 const &ppu, std::vector< uint8_t > *state_) {
+	assert(state_);
+	auto &state = *state_;
+	state.clear();
+
+	//PPU first (it's big and fixed-size, so deltas line up even when the room changes):
+	save_ppu(ppu, &state);
+
+	//then the game:
+	write(&state, sim.room_num);
+	write(&state, sim.player_at);
+	write(&state, sim.ticks);
+	write(&state, sim.explosions);
+	write(&state, sim.rooms_entered);
+
+	//reached bits, packed eight to a byte, archetype by archetype:
+	sim.room.for_each_archetype([&](auto const &archetype){
+		uint32_t count = uint32_t(archetype.entries.size());
+		write(&state, count);
+		uint8_t bits = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+			if (archetype.entries[i].reached) bits |= (1 << (i % 8));
+			if (i % 8 == 7 || i + 1 == count) {
+				write(&state, bits);
+				bits = 0;
+			}
+		}
+	});
+}
+
+void Rewind::save_ppu(PPU466 const &ppu, std::vector< uint8_t > *state) {
+	write(state, ppu.background_color);
+	write(state, ppu.background_position);
+	write(state, ppu.palette_table);
+	write(state, ppu.tile_table);
+	write(state, ppu.background);
+	write(state, ppu.sprites);
+}
+
+void Rewind::load_ppu(std::vector< uint8_t > const &state, size_t *at_, PPU466 *ppu_) {
+	assert(at_);
+	assert(ppu_);
+	size_t &at = *at_;
+	auto &ppu = *ppu_;
+
+	read(state, &at, &ppu.background_color);
+	read(state, &at, &ppu.background_position);
+	read(state, &at, &ppu.palette_table);
+	read(state, &at, &ppu.tile_table);
+	{ //only re-upload the background if it actually changed:
+		if (at + sizeof(ppu.background) > state.size()) throw std::runtime_error("Rewind state is truncated.");
+		if (std::memcmp(ppu.background.data(), &state[at], sizeof(ppu.background)) != 0) {
+			std::memcpy(ppu.background.data(), &state[at], sizeof(ppu.background));
+			ppu.mark_background_dirty();
+		}
+		at += sizeof(ppu.background);
+	}
+	read(state, &at, &ppu.sprites);
+}
+
+void Rewind::load_state(std::vector< uint8_t > const &state, Simulation *sim_, PPU466 *ppu_) {
+	assert(sim_);
+	assert(ppu_);
+	auto &sim = *sim_;
+	auto &ppu = *ppu_;
+
+	size_t at = 0;
+	load_ppu(state, &at, &ppu);
+
+	uint32_t room_num;
+	read(state, &at, &room_num);
+	if (room_num >= sim.rooms->size()) throw std::runtime_error("Rewind state has a room that doesn't exist.");
+	if (room_num != sim.room_num) {
+		sim.room_num = room_num;
+		sim.room.import((*sim.rooms)[room_num]);
+	}
+	read(state, &at, &sim.player_at);
+	read(state, &at, &sim.ticks);
+	read(state, &at, &sim.explosions);
+	read(state, &at, &sim.rooms_entered);
+
+	sim.room.for_each_archetype([&](auto &archetype){
+		uint32_t count;
+		read(state, &at, &count);
+		if (count != archetype.entries.size()) throw std::runtime_error("Rewind state doesn't match room.");
+		uint8_t bits = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+			if (i % 8 == 0) read(state, &at, &bits);
+			archetype.entries[i].reached = ((bits >> (i % 8)) & 1) != 0;
+		}
+	});
+}
+
+//------ history ------
+
+Rewind::Rewind(size_t budget_bytes) : ring(budget_bytes) {
+	assert(budget_bytes > 0);
+}
+
+void Rewind::clear() {
+	newest.clear();
+	begin = 0;
+	used = 0;
+	lengths.clear();
+}
+
+void Rewind::capture(Simulation const &sim, PPU466 const &ppu) {
+	save_state(sim, ppu, &scratch);
+	if (!newest.empty()) {
+		//the old 'newest' becomes a delta from the new one:
+		encode_delta(newest, scratch, &delta);
+		push_delta(delta);
+	}
+	std::swap(newest, scratch);
+}
+
+bool Rewind::rewind(uint32_t steps, Simulation *sim, PPU466 *ppu) {
+	if (steps >= size()) return false;
+	for (uint32_t i = 0; i < steps; ++i) {
+		pop_newest_delta(&delta);
+		apply_delta(delta, &newest);
+	}
+	load_state(newest, sim, ppu);
+	return true;
+}
+
+bool Rewind::peek(uint32_t steps, Simulation *sim, PPU466 *ppu) const {
+	if (steps >= size()) return false;
+	std::vector< uint8_t > state = newest;
+	std::vector< uint8_t > temp;
+	size_t end = used; //offset (from 'begin') just past the delta being read
+	for (uint32_t i = 0; i < steps; ++i) {
+		uint32_t length = lengths[lengths.size() - 1 - i];
+		end -= length;
+		read_delta(end, length, &temp);
+		apply_delta(temp, &state);
+	}
+	load_state(state, sim, ppu);
+	return true;
+}
+
+void Rewind::push_delta(std::vector< uint8_t > const &data) {
+	if (data.size() > ring.size()) {
+		//doesn't fit at all; history can't go back past this point:
+		begin = 0;
+		used = 0;
+		lengths.clear();
+		return;
+	}
+	//make room by dropping the oldest deltas:
+	while (ring.size() - used < data.size()) {
+		begin = (begin + lengths.front()) % ring.size();
+		used -= lengths.front();
+		lengths.pop_front();
+	}
+	size_t end = (begin + used) % ring.size();
+	size_t first = std::min(data.size(), ring.size() - end);
+	std::memcpy(&ring[end], data.data(), first);
+	std::memcpy(&ring[0], data.data() + first, data.size() - first);
+	used += data.size();
+	lengths.emplace_back(uint32_t(data.size()));
+}
+
+void Rewind::read_delta(size_t offset, uint32_t length, std::vector< uint8_t > *data) const {
+	data->resize(length);
+	size_t start = (begin + offset) % ring.size();
+	size_t first = std::min< size_t >(length, ring.size() - start);
+	std::memcpy(data->data(), &ring[start], first);
+	std::memcpy(data->data() + first, &ring[0], length - first);
+}
+
+void Rewind::pop_newest_delta(std::vector< uint8_t > *data) {
+	assert(!lengths.empty());
+	uint32_t length = lengths.back();
+	read_delta(used - length, length, data);
+	used -= length;
+	lengths.pop_back();
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+/*
+ * Rewind -- a memory-bounded history of game + PPU state, captured every tick.
+ *
+ * The newest state is kept whole; every older state is stored as a run-length-encoded
+ * XOR delta against the state that came after it. Since consecutive ticks differ in
+ * only a few bytes, minutes of history fit in a few megabytes. When the budget is used
+ * up, the oldest deltas are dropped (nothing depends on them).
+ *
+ * Rewind history(4 << 20); //4MB
+ * history.capture(*game, ppu); //every tick
+ * history.rewind(1, game.get(), &ppu); //step back one tick (discarding it)
+ * history.peek(600, &copy, &ppu_copy); //look ten seconds back without discarding anything
+ *
+ */
+
+#include "Simulation.hpp"
+#include "PPU466.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+struct Rewind {
+	Rewind(size_t budget_bytes = 4 << 20);
+
+	//record the current state as the newest snapshot:
+	void capture(Simulation const &sim, PPU466 const &ppu);
+
+	//restore the state from 'steps' snapshots ago, discarding the newer ones:
+	// (steps == 0 restores the newest snapshot; returns false if there isn't that much history)
+	bool rewind(uint32_t steps, Simulation *sim, PPU466 *ppu);
+
+	//restore the state from 'steps' snapshots ago without changing the history:
+	bool peek(uint32_t steps, Simulation *sim, PPU466 *ppu) const;
+
+	//forget everything:
+	void clear();
+
+	//number of snapshots held:
+	size_t size() const { return newest.empty() ? 0 : 1 + lengths.size(); }
+	//bytes of history held:
+	size_t bytes() const { return newest.size() + used; }
+
+	//----- internals -----
+
+	//state serialization:
+	static void save_state(Simulation const &sim, PPU466 const &ppu, std::vector< uint8_t > *state);
+	static void load_state(std::vector< uint8_t > const &state, Simulation *sim, PPU466 *ppu);
+	// (...just the PPU part, which comes first; PPUStream records these too)
+	static void save_ppu(PPU466 const &ppu, std::vector< uint8_t > *state); //(appends)
+	static void load_ppu(std::vector< uint8_t > const &state, size_t *at, PPU466 *ppu);
+
+	//delta encoding: a delta that turns 'newer' into 'older'
+	// (it's an XOR, so encode_delta(b, a, &delta) makes a delta that turns 'a' into 'b')
+	static void encode_delta(std::vector< uint8_t > const &older, std::vector< uint8_t > const &newer, std::vector< uint8_t > *delta);
+	static void apply_delta(std::vector< uint8_t > const &delta, std::vector< uint8_t > *state);
+
+	std::vector< uint8_t > newest; //newest snapshot, whole
+	std::vector< uint8_t > scratch; //state being captured / encoded delta (reused to avoid allocation)
+	std::vector< uint8_t > delta;
+
+	//deltas live in a ring of bytes: [begin, begin + used) (mod ring.size()), oldest first
+	std::vector< uint8_t > ring;
+	size_t begin = 0;
+	size_t used = 0;
+	std::deque< uint32_t > lengths; //length of each delta in the ring, oldest first
+
+	void push_delta(std::vector< uint8_t > const &delta);
+	void pop_newest_delta(std::vector< uint8_t > *delta);
+	void read_delta(size_t offset, uint32_t length, std::vector< uint8_t > *delta) const;
+};
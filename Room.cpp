@@ -0,0 +1,44 @@
+#include "Room.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+std::vector< Object > decode_room(uint8_t const *data, size_t size) {
+	//old format: raw (native-endian, padded) Object structs, as written before rooms had a header:
+	// (their first byte is an obj_type of 0-2, never 'R')
+	struct OldObject {
+		int32_t obj_type;
+		uint8_t reached, x, y, padding;
+	};
+	static_assert(sizeof(OldObject) == 8, "OldObject is packed");
+	if (size == 0 || data[0] != 'R') {
+		if (size % sizeof(OldObject) != 0) throw std::runtime_error("Room data is neither the current nor the old format");
+		std::vector< Object > objects(size / sizeof(OldObject));
+		for (size_t i = 0; i < objects.size(); i++) {
+			OldObject old;
+			std::memcpy(&old, data + i * sizeof(OldObject), sizeof(OldObject));
+			objects[i].obj_type = old.obj_type;
+			objects[i].x = old.x;
+			objects[i].y = old.y;
+		}
+		return objects;
+	}
+
+	if (size < RoomHeaderSize) throw std::runtime_error("Room data is truncated");
+	if (data[1] != RoomFormatVersion) {
+		throw std::runtime_error("Room data is version " + std::to_string(data[1]) + "; expected " + std::to_string(RoomFormatVersion) + " (rebuild tiles.bin with pack-tiles)");
+	}
+	size_t count = size_t(data[2]) | (size_t(data[3]) << 8);
+	if (size != RoomHeaderSize + RoomObjectSize * count) throw std::runtime_error("Room data is the wrong size for its object count");
+
+	//(no branches in this loop, so the compiler is free to vectorize it)
+	std::vector< Object > objects(count);
+	uint8_t const *at = data + RoomHeaderSize;
+	for (size_t i = 0; i < count; i++) {
+		objects[i].obj_type = at[RoomObjectSize * i + 0];
+		objects[i].x = at[RoomObjectSize * i + 1];
+		objects[i].y = at[RoomObjectSize * i + 2];
+	}
+	return objects;
+}
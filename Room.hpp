@@ -1,13 +1,51 @@
+#pragma once
+
 #include <vector>
+#include <cstdint>
+#include <cstddef>
 
 struct Object {
 	int obj_type = 3;     // 0 for torch, 1 for key, 2 for bomb
 	bool reached = false; // Has been reached by player
 	uint8_t x;            // x position
 	uint8_t y;            // y position
+
+	// Fields stored in tiles.bin (see read_write_flat.hpp) -- three bytes per object
+	// (bump RoomsVersion when these change)
+	template< typename O, typename V > static void reflect(O &object, V &&visit) {
+		visit(object.obj_type, uint8_t());
+		visit(object.x);
+		visit(object.y);
+	}
 };
 
 struct Room {
 	bool locked = true;            // It's only a chest until the player opens it
 	std::vector< Object > objects; // All the objects in this room
-};
\ No newline at end of file
+
+	// (bump RoomsVersion when these change)
+	template< typename R, typename V > static void reflect(R &room, V &&visit) {
+		visit(room.locked);
+		visit(room.objects);
+	}
+};
+//All rooms are stored (in tiles.bin) as one flattened std::vector< Room >, the "rms7" chunk:
+// |version (4 bytes, little-endian)|flattened rooms...|
+//The version changes whenever Room::reflect or Object::reflect do, so files packed with the old
+// layout are rejected rather than misread. (Files from before the version word start with the
+// rooms' offset, which is at least 8, so they are rejected too.)
+enum : uint32_t {
+	RoomsVersion = 1,
+};
+
+//Older tiles.bin files have one chunk per room ("rom2", "rom3", ...), each a byte string:
+// |'R'|ver|count lo|count hi| <-- header: version (RoomFormatVersion), little-endian object count
+// |type|x|y| * count          <-- three bytes per object
+enum : uint8_t {
+	RoomFormatVersion = 1,
+	RoomHeaderSize = 4,
+	RoomObjectSize = 3,
+};
+
+//NOTE: decode_room throws on unknown versions; data in the oldest format (raw Object structs) is converted
+std::vector< Object > decode_room(uint8_t const *data, size_t size);
@@ -0,0 +1,126 @@
+#include "Simulation.hpp"
+
+#include "PPU466.hpp"
+#include "MappedChunks.hpp"
+#include "read_write_flat.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+constexpr float Simulation::DoorX;
+constexpr float Simulation::DoorY;
+
+RoomList::RoomList(std::vector< std::vector< Object > > const &rooms_) : count(rooms_.size()), rooms(rooms_) {
+}
+
+RoomList::RoomList(size_t count_, std::function< std::vector< Object >(size_t) > const &load_)
+	: count(count_), load(load_), rooms(count_), loaded(new Loaded[count_]) {
+}
+
+std::vector< Object > const &RoomList::operator[](size_t index) const {
+	assert(index < count);
+	if (load && !loaded[index].done.load(std::memory_order_acquire)) {
+		std::lock_guard< std::mutex > lock(loaded[index].mutex);
+		if (!loaded[index].done.load(std::memory_order_relaxed)) {
+			rooms[index] = load(index); //(if this throws, 'done' stays false)
+			loaded[index].done.store(true, std::memory_order_release);
+		}
+	}
+	return rooms[index];
+}
+
+std::shared_ptr< RoomList > read_rooms(std::shared_ptr< MappedChunks const > const &from) {
+	if (from->has_chunk("rms7")) {
+		//rooms are decoded in place, unless the chunk needs decompressing first:
+		std::shared_ptr< std::vector< char > > copy;
+		char const *data = nullptr;
+		uint32_t size = 0;
+		if (from->directory.at("rms7").compressed) {
+			copy = std::make_shared< std::vector< char > >();
+			load_chunk(*from, "rms7", copy.get());
+			data = copy->data();
+			size = uint32_t(copy->size());
+		} else {
+			data = from->chunk_data("rms7", &size);
+		}
+		//(see Room.hpp for the version word)
+		if (size < 4) throw std::runtime_error("Rooms chunk is truncated (rebuild tiles.bin with pack-tiles)");
+		uint32_t version = uint32_t(uint8_t(data[0])) | (uint32_t(uint8_t(data[1])) << 8) | (uint32_t(uint8_t(data[2])) << 16) | (uint32_t(uint8_t(data[3])) << 24);
+		if (version != RoomsVersion) {
+			throw std::runtime_error("Rooms are version " + std::to_string(version) + "; expected " + std::to_string(RoomsVersion) + " (rebuild tiles.bin with pack-tiles)");
+		}
+		FlatArray< Room > rooms(data + 4, size - 4);
+		return std::make_shared< RoomList >(rooms.size(), [from, copy, rooms](size_t index) {
+			return rooms.load(index).objects;
+		});
+	}
+
+	//older files: "rom2", "rom3", ...
+	std::vector< std::string > chunks;
+	for (char digit = '2'; digit <= '9' && from->has_chunk(std::string("rom") + digit); digit++) {
+		chunks.emplace_back(std::string("rom") + digit);
+	}
+	return std::make_shared< RoomList >(chunks.size(), [from, chunks](size_t index) {
+		std::vector< uint8_t > room;
+		load_chunk(*from, chunks[index], &room);
+		return decode_room(room.data(), room.size());
+	});
+}
+
+Simulation::Simulation(std::shared_ptr< RoomList const > const &rooms_) : rooms(rooms_) {
+	assert(rooms && !rooms->empty());
+	load_room(0);
+}
+
+void Simulation::load_room(uint32_t num) {
+	assert(num < rooms->size());
+	room_num = num;
+	room.import((*rooms)[room_num]);
+	player_at = glm::vec2(0.0f);
+	rooms_entered += 1;
+}
+
+void Simulation::update(Controls const &controls, float elapsed) {
+	ticks += 1;
+
+	constexpr float PlayerSpeed = 50.0f;
+	if (controls.left) player_at.x -= PlayerSpeed * elapsed;
+	if (controls.right) player_at.x += PlayerSpeed * elapsed;
+	if (controls.down) player_at.y -= PlayerSpeed * elapsed;
+	if (controls.up) player_at.y += PlayerSpeed * elapsed;
+
+	// No wrapping >:(
+	if (player_at.x > (PPU466::ScreenWidth - 8)) {
+		player_at.x = PPU466::ScreenWidth - 8;
+	}
+	if (player_at.x < 0) {
+		player_at.x = 0;
+	}
+
+	if (player_at.y > (PPU466::ScreenHeight - 8)) {
+		player_at.y = PPU466::ScreenHeight - 8;
+	}
+	if (player_at.y < 0) {
+		player_at.y = 0;
+	}
+
+	// Collision check (may light torches, open chests, or set off a bomb)
+	bool explode = (room.collide(player_at) & ObjectEventExplode) != 0;
+
+	// Once player reaches the open door (and it's not the last room), go to next room
+	if (door_open() && (room_num + 1 < rooms->size())
+	 && glm::distance(glm::vec2(DoorX, DoorY), player_at) < 5) {
+		load_room(room_num + 1);
+		return;
+	}
+
+	if (explode) {
+		explosions += 1;
+		// Reset everything but the bombs (keep showing explosion after reset
+		// as a kindness to the player)
+		room.reset_after_explosion();
+		// Put player back at starting position
+		player_at = glm::vec2(0.0f);
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+/*
+ * Simulation -- the game rules, with no window, GL context, or PPU.
+ *
+ * PlayMode feeds it input and draws its state; BatchSim runs thousands of them at once.
+ *
+ */
+
+#include "Room.hpp"
+#include "ObjectStore.hpp"
+
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+struct MappedChunks;
+
+//the object lists for every room, in play order (shared, read-only, by all simulations):
+struct RoomList {
+	//rooms that are already in memory:
+	RoomList(std::vector< std::vector< Object > > const &rooms);
+	//'count' rooms, each fetched with load(index) the first time it is used:
+	// (so a level pack with hundreds of rooms only reads the ones that get played)
+	RoomList(size_t count, std::function< std::vector< Object >(size_t) > const &load);
+
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+
+	//objects in room 'index' (loading it if needed; safe to call from several threads):
+	// (if load() throws, the exception is passed on and the room stays unloaded, so the next call tries again)
+	std::vector< Object > const &operator[](size_t index) const;
+
+	//----- internals -----
+	size_t count = 0;
+	std::function< std::vector< Object >(size_t) > load;
+	mutable std::vector< std::vector< Object > > rooms;
+	//per-room load state (not std::call_once, which hangs later callers if 'load' throws with libstdc++):
+	struct Loaded {
+		std::atomic< bool > done{false};
+		std::mutex mutex;
+	};
+	mutable std::unique_ptr< Loaded[] > loaded;
+};
+
+//every room in tiles.bin, each decoded (straight out of the mapped file) the first time it is used:
+// (reads the "rms7" chunk; older files with one "romN" chunk per room work, too)
+std::shared_ptr< RoomList > read_rooms(std::shared_ptr< MappedChunks const > const &from);
+
+struct Simulation {
+	Simulation(std::shared_ptr< RoomList const > const &rooms);
+
+	//which buttons are held during an update:
+	struct Controls {
+		bool left = false;
+		bool right = false;
+		bool down = false;
+		bool up = false;
+	};
+
+	//advance the game by 'elapsed' seconds:
+	void update(Controls const &controls, float elapsed);
+
+	//switch to room 'num' and reset the player:
+	void load_room(uint32_t num);
+
+	//----- game state -----
+
+	std::shared_ptr< RoomList const > rooms;
+
+	uint32_t room_num = 0;
+	ObjectStore room; //objects in current room
+
+	//player position:
+	glm::vec2 player_at = glm::vec2(0.0f);
+
+	//door to the next room is open once the room is complete:
+	bool door_open() const { return room.complete(); }
+	static constexpr float DoorX = 248.0f;
+	static constexpr float DoorY = 232.0f;
+
+	//the game is over once the last room is complete:
+	bool finished() const { return room_num + 1 >= rooms->size() && room.complete(); }
+
+	//----- statistics -----
+	uint32_t ticks = 0; //calls to update()
+	uint32_t explosions = 0; //bombs set off
+	uint32_t rooms_entered = 0; //incremented by every load_room()
+};
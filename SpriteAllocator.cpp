@@ -0,0 +1,80 @@
+#include "SpriteAllocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+void SpriteAllocator::add(glm::ivec2 const &at, uint8_t index, uint8_t attributes, float priority, bool pinned) {
+	//cull sprites that can't be placed on the screen:
+	if (at.x < 0 || at.x >= int32_t(PPU466::ScreenWidth) || at.y < 0 || at.y >= int32_t(PPU466::ScreenHeight)) {
+		pending_culled += 1;
+		return;
+	}
+
+	Request request;
+	request.sprite.x = uint8_t(at.x);
+	request.sprite.y = uint8_t(at.y);
+	request.sprite.index = index;
+	request.sprite.attributes = attributes;
+	request.priority = priority;
+	request.pinned = pinned;
+	requests.emplace_back(request);
+}
+
+void SpriteAllocator::commit(PPU466 *ppu_) {
+	assert(ppu_);
+	auto &sprites = ppu_->sprites;
+	const uint32_t slots = uint32_t(sprites.size());
+
+	//pinned sprites first (in the order they were added), then everything else by priority:
+	// (stable so that equal priorities don't flicker between frames)
+	std::stable_sort(requests.begin(), requests.end(), [](Request const &a, Request const &b) {
+		if (a.pinned != b.pinned) return a.pinned;
+		if (a.pinned) return false;
+		return a.priority < b.priority;
+	});
+
+	uint32_t pinned = 0;
+	while (pinned < requests.size() && requests[pinned].pinned) ++pinned;
+	assert(pinned <= slots && "More pinned sprites than the PPU can draw.");
+	pinned = std::min(pinned, slots);
+
+	uint32_t next = 0; //next slot to fill
+	for (uint32_t i = 0; i < pinned; ++i) {
+		sprites[next++] = requests[i].sprite;
+	}
+
+	const uint32_t rest = uint32_t(requests.size()) - pinned;
+	const uint32_t free = slots - pinned;
+	multiplexed = 0;
+	if (rest <= free) {
+		//everything fits:
+		for (uint32_t i = pinned; i < requests.size(); ++i) {
+			sprites[next++] = requests[i].sprite;
+		}
+	} else {
+		//closest sprites get fixed slots:
+		const uint32_t rotating = std::min(multiplex_slots, free);
+		const uint32_t fixed = free - rotating;
+		for (uint32_t i = 0; i < fixed; ++i) {
+			sprites[next++] = requests[pinned + i].sprite;
+		}
+
+		//everything else takes turns in the rotating slots:
+		multiplexed = rest - fixed;
+		const uint32_t begin = pinned + fixed;
+		const uint32_t offset = uint32_t((uint64_t(frame) * rotating) % multiplexed);
+		for (uint32_t i = 0; i < rotating; ++i) {
+			sprites[next++] = requests[begin + (offset + i) % multiplexed].sprite;
+		}
+	}
+
+	//unused slots are moved off the screen:
+	while (next < slots) {
+		sprites[next++] = PPU466::Sprite();
+	}
+
+	culled = pending_culled;
+	pending_culled = 0;
+	requests.clear();
+	frame += 1;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+/*
+ * SpriteAllocator -- hands out the PPU466's 64 hardware sprites to game objects.
+ *
+ * Each frame, add() every sprite you would like to draw, then commit() to the PPU:
+ *  - sprites that are off-screen are culled
+ *  - 'pinned' sprites (e.g. the player) always get a slot
+ *  - the rest are placed in order of increasing 'priority' (e.g. distance to the player)
+ *  - if there are more sprites than slots, the last 'multiplex_slots' slots rotate
+ *    (multiplex) through the sprites that didn't fit, so everything gets shown some of the time
+ *  - slots that aren't used are moved off-screen (y = 240)
+ *
+ */
+
+#include "PPU466.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+struct SpriteAllocator {
+	//Queue a sprite for this frame:
+	// 'at' is the lower-left of the sprite in screen pixels (may be off-screen)
+	// lower 'priority' values are placed first
+	void add(glm::ivec2 const &at, uint8_t index, uint8_t attributes, float priority, bool pinned = false);
+
+	//Assign queued sprites to ppu->sprites, clear unused slots, and empty the queue:
+	void commit(PPU466 *ppu);
+
+	//number of slots (of those not taken by pinned sprites) used for rotating through
+	// sprites that don't fit; the remaining slots always go to the highest-priority sprites:
+	uint32_t multiplex_slots = 16;
+
+	//statistics from the most recent commit():
+	uint32_t culled = 0; //sprites that were off-screen
+	uint32_t multiplexed = 0; //sprites that are being rotated through 'multiplex_slots'
+
+	//----- internals -----
+	struct Request {
+		PPU466::Sprite sprite;
+		float priority;
+		bool pinned;
+	};
+	std::vector< Request > requests;
+
+	uint32_t pending_culled = 0; //culled since the last commit()
+	uint32_t frame = 0; //advances every commit(); drives the multiplexing rotation
+};
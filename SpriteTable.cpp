@@ -0,0 +1,33 @@
+#include "SpriteTable.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+
+void SpriteTable::read(MappedChunks const &from) {
+	load_chunk(from, "spr5", &refs);
+	load_chunk(from, "met6", &tiles);
+	if (refs.size() != SpriteCount) {
+		throw std::runtime_error("Expected " + std::to_string(SpriteCount) + " sprites in tiles.bin, got " + std::to_string(refs.size()) + ".");
+	}
+
+	begin.assign(SpriteCount + 1, uint32_t(tiles.size()));
+	for (uint32_t i = uint32_t(tiles.size()); i > 0; i--) {
+		MetaspriteTile const &tile = tiles[i-1];
+		if (tile.sprite >= SpriteCount || (i < tiles.size() && tiles[i].sprite < tile.sprite)) {
+			throw std::runtime_error("Metasprite tiles in tiles.bin are not grouped by sprite.");
+		}
+		begin[tile.sprite] = i-1;
+	}
+	//sprites without tiles start where the next sprite does:
+	for (uint32_t s = SpriteCount; s > 0; s--) {
+		begin[s-1] = std::min(begin[s-1], begin[s]);
+	}
+}
+
+void SpriteTable::add(SpriteAllocator *sprites, glm::ivec2 const &at, SpriteId id, uint8_t extra_attributes, float priority, bool pinned) const {
+	for (uint32_t i = begin[id]; i < begin[id+1]; i++) {
+		MetaspriteTile const &tile = tiles[i];
+		sprites->add(at + glm::ivec2(tile.x, tile.y), tile.index, tile.attributes | extra_attributes, priority, pinned);
+	}
+}
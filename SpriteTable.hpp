@@ -0,0 +1,57 @@
+#pragma once
+
+#include "SpriteAllocator.hpp"
+#include "MappedChunks.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Which tiles and attributes draw each of the game's sprites.
+// pack-tiles merges identical (and flipped or recolored) tiles, so sprite N is no longer
+// just tile N with palette N; it writes this table to tiles.bin instead.
+//
+// A sprite image may be bigger than 8x8 (a "metasprite"): pack-tiles slices it into 8x8
+// tiles, and the game draws it as one PPU sprite per (non-empty) tile.
+
+// Sprites, in the same order as the sprite images in CreateTiles
+enum SpriteId : uint8_t {
+	SpriteFlame,
+	SpriteUnlitTorch,
+	SpriteLitTorch,
+	SpriteChest,
+	SpriteKey,
+	SpriteExplosion,
+	SpriteDoor,
+	SpriteCount
+};
+
+// First (lower-left) tile of each sprite -- the "spr5" chunk
+struct SpriteRef {
+	uint8_t index = 0;      // index into tile table
+	uint8_t attributes = 0; // palette index and flip bits (see PPU466::Sprite)
+};
+static_assert(sizeof(SpriteRef) == 2, "SpriteRef is packed");
+
+// Every tile of every sprite, grouped by sprite in SpriteId order -- the "met6" chunk
+struct MetaspriteTile {
+	uint8_t sprite = 0;     // SpriteId this tile belongs to
+	uint8_t x = 0, y = 0;   // offset (in pixels) from the sprite's lower-left
+	uint8_t index = 0;      // index into tile table
+	uint8_t attributes = 0; // palette index and flip bits
+};
+static_assert(sizeof(MetaspriteTile) == 5, "MetaspriteTile is packed");
+
+struct SpriteTable {
+	std::vector< SpriteRef > refs;
+	std::vector< MetaspriteTile > tiles;
+	std::vector< uint32_t > begin; // tiles of sprite s are [begin[s], begin[s+1])
+
+	// Read the "spr5" and "met6" chunks of tiles.bin:
+	void read(MappedChunks const &from);
+
+	// Queue all the tiles of a sprite with its lower-left at 'at':
+	// (extra_attributes are or'd into each tile's attributes, e.g. the priority bit)
+	void add(SpriteAllocator *sprites, glm::ivec2 const &at, SpriteId id, uint8_t extra_attributes, float priority, bool pinned = false) const;
+};
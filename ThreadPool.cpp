@@ -0,0 +1,146 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+//which pool (and which worker in it) the current thread is:
+static thread_local ThreadPool *current_pool = nullptr;
+static thread_local uint32_t current_worker = 0;
+
+ThreadPool::ThreadPool(uint32_t count) : queued(0), unfinished(0), next_worker(0) {
+	if (count == 0) count = std::max(1U, std::thread::hardware_concurrency());
+
+	workers.reserve(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		workers.emplace_back(new Worker);
+	}
+	threads.reserve(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		threads.emplace_back(&ThreadPool::worker_loop, this, i);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::unique_lock< std::mutex > lock(sleep_mutex);
+		quit = true;
+	}
+	wake.notify_all();
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	if (error) {
+		try {
+			std::rethrow_exception(error);
+		} catch (std::exception &e) {
+			std::cerr << "WARNING: a ThreadPool task threw (and nothing waited for it): " << e.what() << std::endl;
+		} catch (...) {
+			std::cerr << "WARNING: a ThreadPool task threw (and nothing waited for it)." << std::endl;
+		}
+	}
+}
+
+void ThreadPool::run(std::function< void() > const &task) {
+	//tasks queued from a worker stay on that worker; others are dealt round-robin:
+	uint32_t index;
+	if (current_pool == this) {
+		index = current_worker;
+	} else {
+		index = next_worker.fetch_add(1) % uint32_t(workers.size());
+	}
+
+	//(count the task before it's visible, so a worker that takes it right away can't take 'queued' below zero)
+	unfinished.fetch_add(1);
+	queued.fetch_add(1);
+	{
+		std::unique_lock< std::mutex > lock(workers[index]->mutex);
+		workers[index]->tasks.emplace_back(task);
+	}
+
+	{ //(lock so a worker can't miss the wakeup between checking 'queued' and sleeping)
+		std::unique_lock< std::mutex > lock(sleep_mutex);
+	}
+	wake.notify_one();
+}
+
+void ThreadPool::wait() {
+	assert(current_pool != this && "ThreadPool::wait() called from a task would deadlock.");
+	std::unique_lock< std::mutex > lock(sleep_mutex);
+	done.wait(lock, [this](){ return unfinished.load() == 0; });
+	if (error) {
+		std::exception_ptr failed = error;
+		error = nullptr;
+		std::rethrow_exception(failed);
+	}
+}
+
+void ThreadPool::parallel_for(size_t count, std::function< void(size_t) > const &fn, size_t grain) {
+	grain = std::max< size_t >(1, grain);
+	for (size_t begin = 0; begin < count; begin += grain) {
+		size_t end = std::min(count, begin + grain);
+		run([&fn,begin,end](){
+			for (size_t i = begin; i < end; ++i) {
+				fn(i);
+			}
+		});
+	}
+	wait();
+}
+
+bool ThreadPool::take(uint32_t index, std::function< void() > *task) {
+	{ //own queue first, newest task (it's probably still in cache):
+		Worker &worker = *workers[index];
+		std::unique_lock< std::mutex > lock(worker.mutex);
+		if (!worker.tasks.empty()) {
+			*task = std::move(worker.tasks.back());
+			worker.tasks.pop_back();
+			queued.fetch_sub(1);
+			return true;
+		}
+	}
+	//then steal the oldest task from someone else:
+	for (uint32_t offset = 1; offset < workers.size(); ++offset) {
+		Worker &victim = *workers[(index + offset) % workers.size()];
+		std::unique_lock< std::mutex > lock(victim.mutex);
+		if (!victim.tasks.empty()) {
+			*task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			queued.fetch_sub(1);
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::worker_loop(uint32_t index) {
+	current_pool = this;
+	current_worker = index;
+
+	while (true) {
+		std::function< void() > task;
+		if (take(index, &task)) {
+			std::exception_ptr failed;
+			try {
+				task();
+			} catch (...) {
+				failed = std::current_exception();
+			}
+			if (failed) {
+				std::unique_lock< std::mutex > lock(sleep_mutex);
+				if (!error) error = failed;
+			}
+			if (unfinished.fetch_sub(1) == 1) {
+				std::unique_lock< std::mutex > lock(sleep_mutex);
+				done.notify_all();
+			}
+			continue;
+		}
+
+		std::unique_lock< std::mutex > lock(sleep_mutex);
+		wake.wait(lock, [this](){ return quit || queued.load() > 0; });
+		if (quit && queued.load() == 0) break;
+	}
+
+	current_pool = nullptr;
+}
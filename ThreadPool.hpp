@@ -0,0 +1,69 @@
+#pragma once
+
+/*
+ * ThreadPool -- a small work-stealing pool of worker threads.
+ *
+ * Each worker has its own queue of tasks:
+ *  - tasks queued from a worker go on that worker's queue (and it runs them newest-first)
+ *  - tasks queued from elsewhere are dealt round-robin to the workers
+ *  - a worker with nothing to do steals the oldest task from another worker's queue
+ *
+ * ThreadPool pool; //one thread per core
+ * pool.parallel_for(runs.size(), [&](size_t i){ runs[i].simulate(); });
+ *
+ * A task that throws doesn't take down its worker: the exception is handed to the next wait()
+ *  (or printed by the destructor, if nothing waits), so tasks that are never waited for
+ *  should catch their own errors.
+ *
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct ThreadPool {
+	//'threads' of zero means one per hardware thread:
+	ThreadPool(uint32_t threads = 0);
+	~ThreadPool(); //finishes all queued tasks, then joins the workers
+
+	//Queue a task (may be called from any thread, including from inside a task):
+	void run(std::function< void() > const &task);
+
+	//Block until every queued task (and any tasks they queue) has finished:
+	// (don't call from inside a task)
+	//If a task threw, the first exception is rethrown here (after the other tasks finish).
+	void wait();
+
+	//Call fn(i) for every i in [0,count), in chunks of 'grain' indices, and wait for them all:
+	// (rethrows the first exception fn threw, like wait())
+	void parallel_for(size_t count, std::function< void(size_t) > const &fn, size_t grain = 1);
+
+	uint32_t size() const { return uint32_t(threads.size()); }
+
+	//----- internals -----
+	struct Worker {
+		std::mutex mutex;
+		std::deque< std::function< void() > > tasks;
+	};
+	std::vector< std::unique_ptr< Worker > > workers;
+	std::vector< std::thread > threads;
+
+	std::atomic< uint32_t > queued; //tasks sitting in queues
+	std::atomic< uint32_t > unfinished; //tasks queued or running
+	std::atomic< uint32_t > next_worker; //for dealing out tasks queued from outside the pool
+
+	std::mutex sleep_mutex; //guards sleeping and waking (and 'error'), below:
+	std::condition_variable wake; //signalled when a task is queued (or on shutdown)
+	std::condition_variable done; //signalled when 'unfinished' reaches zero
+	bool quit = false;
+	std::exception_ptr error; //first exception thrown by a task since the last wait()
+
+	void worker_loop(uint32_t index);
+	bool take(uint32_t index, std::function< void() > *task);
+};
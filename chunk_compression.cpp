@@ -0,0 +1,208 @@
+#include "chunk_compression.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+ChunkCodec chunk_codec(std::string const &name) {
+	if (name == "raw") return ChunkRaw;
+	if (name == "zlib") return ChunkZlib;
+	if (name == "lz") return ChunkLZ;
+	throw std::runtime_error("Unknown chunk codec '" + name + "' (expected raw, zlib, or lz)");
+}
+
+char const *chunk_codec_name(ChunkCodec codec) {
+	if (codec == ChunkRaw) return "raw";
+	if (codec == ChunkZlib) return "zlib";
+	if (codec == ChunkLZ) return "lz";
+	return "unknown";
+}
+
+//----- LZ -----
+//The compressed data is a list of sequences:
+// |token| <-- high four bits: literal count, low four bits: match length - MinMatch
+// |extra literal count| <-- if literal count was 15: bytes added to it, until a byte isn't 255
+// |literals...|
+// |offset lo|offset hi| <-- how far back the match starts (omitted in the last sequence)
+// |extra match length| <-- if match length was 15 + MinMatch: like extra literal count
+//The last sequence is just literals.
+
+static const uint32_t MinMatch = 4;
+static const uint32_t MaxOffset = 0xffff;
+static const uint32_t HashBits = 14;
+
+static void write_length(std::vector< char > *out, size_t length) {
+	while (length >= 255) {
+		out->push_back(char(255));
+		length -= 255;
+	}
+	out->push_back(char(length));
+}
+
+static std::vector< char > compress_lz(uint8_t const *in, size_t size) {
+	std::vector< char > out;
+	out.reserve(size / 2 + 16);
+	std::vector< uint32_t > table(size_t(1) << HashBits, uint32_t(-1));
+
+	auto hash = [&](size_t at) {
+		uint32_t v;
+		std::memcpy(&v, in + at, 4);
+		return (v * 2654435761U) >> (32 - HashBits);
+	};
+
+	auto emit = [&](size_t literal_begin, size_t literal_end, size_t offset, size_t match_length) {
+		size_t literals = literal_end - literal_begin;
+		size_t match = (match_length ? match_length - MinMatch : 0);
+		out.push_back(char((std::min< size_t >(literals, 15) << 4) | std::min< size_t >(match, 15)));
+		if (literals >= 15) write_length(&out, literals - 15);
+		out.insert(out.end(), in + literal_begin, in + literal_end);
+		if (match_length) {
+			out.push_back(char(offset & 0xff));
+			out.push_back(char(offset >> 8));
+			if (match >= 15) write_length(&out, match - 15);
+		}
+	};
+
+	size_t literal_begin = 0;
+	size_t at = 0;
+	while (size >= MinMatch && at + MinMatch <= size) {
+		uint32_t h = hash(at);
+		uint32_t candidate = table[h];
+		table[h] = uint32_t(at);
+		if (candidate != uint32_t(-1) && at - candidate <= MaxOffset && std::memcmp(in + candidate, in + at, MinMatch) == 0) {
+			size_t length = MinMatch;
+			while (at + length < size && in[candidate + length] == in[at + length]) length++;
+			emit(literal_begin, at, at - candidate, length);
+			at += length;
+			literal_begin = at;
+		} else {
+			at++;
+		}
+	}
+	emit(literal_begin, size, 0, 0);
+	return out;
+}
+
+static void decompress_lz(uint8_t const *in, size_t in_size, uint8_t *out, size_t out_size) {
+	size_t i = 0, o = 0;
+	auto read_length = [&](size_t length) {
+		uint8_t b;
+		do {
+			if (i >= in_size) throw std::runtime_error("LZ data is truncated");
+			b = in[i++];
+			length += b;
+		} while (b == 255);
+		return length;
+	};
+
+	while (true) {
+		if (i >= in_size) throw std::runtime_error("LZ data is truncated");
+		uint8_t token = in[i++];
+		size_t literals = token >> 4;
+		if (literals == 15) literals = read_length(literals);
+		if (in_size - i < literals || out_size - o < literals) throw std::runtime_error("LZ literals out of range");
+		if (literals) std::memcpy(out + o, in + i, literals);
+		i += literals;
+		o += literals;
+		if (i == in_size) break; //(last sequence)
+
+		if (in_size - i < 2) throw std::runtime_error("LZ data is truncated");
+		size_t offset = size_t(in[i]) | (size_t(in[i+1]) << 8);
+		i += 2;
+		size_t length = token & 0xf;
+		if (length == 15) length = read_length(length);
+		length += MinMatch;
+		if (offset == 0 || offset > o || out_size - o < length) throw std::runtime_error("LZ match out of range");
+		uint8_t const *from = out + o - offset;
+		if (offset >= length) {
+			std::memcpy(out + o, from, length);
+		} else {
+			//(byte by byte, since the match overlaps the bytes it produces)
+			for (size_t k = 0; k < length; k++) {
+				out[o + k] = from[k];
+			}
+		}
+		o += length;
+	}
+	if (o != out_size) throw std::runtime_error("LZ data decompressed to the wrong size");
+}
+
+//----- interface -----
+
+std::vector< char > compress_chunk(ChunkCodec codec, void const *data, size_t size) {
+	if (codec == ChunkRaw) {
+		return std::vector< char >(reinterpret_cast< char const * >(data), reinterpret_cast< char const * >(data) + size);
+	} else if (codec == ChunkZlib) {
+		uLongf out_size = compressBound(uLong(size));
+		std::vector< char > out(out_size);
+		if (compress2(reinterpret_cast< Bytef * >(out.data()), &out_size, reinterpret_cast< Bytef const * >(data), uLong(size), Z_BEST_COMPRESSION) != Z_OK) {
+			throw std::runtime_error("zlib failed to compress chunk");
+		}
+		out.resize(out_size);
+		return out;
+	} else if (codec == ChunkLZ) {
+		return compress_lz(reinterpret_cast< uint8_t const * >(data), size);
+	}
+	throw std::runtime_error("Unknown chunk codec " + std::to_string(uint32_t(codec)));
+}
+
+void decompress_chunk(ChunkCodec codec, void const *from, size_t from_size, void *to, size_t to_size) {
+	if (codec == ChunkRaw) {
+		if (from_size != to_size) throw std::runtime_error("Raw chunk is the wrong size");
+		std::memcpy(to, from, to_size);
+	} else if (codec == ChunkZlib) {
+		uLongf out_size = uLongf(to_size);
+		if (uncompress(reinterpret_cast< Bytef * >(to), &out_size, reinterpret_cast< Bytef const * >(from), uLong(from_size)) != Z_OK || out_size != to_size) {
+			throw std::runtime_error("zlib failed to decompress chunk");
+		}
+	} else if (codec == ChunkLZ) {
+		decompress_lz(reinterpret_cast< uint8_t const * >(from), from_size, reinterpret_cast< uint8_t * >(to), to_size);
+	} else {
+		throw std::runtime_error("Unknown chunk codec " + std::to_string(uint32_t(codec)));
+	}
+}
+
+void decompress_chunk(ChunkCodec codec, std::istream &from, size_t from_size, void *to, size_t to_size) {
+	if (codec == ChunkZlib) {
+		//inflate as compressed bytes arrive, straight into 'to':
+		z_stream stream;
+		std::memset(&stream, 0, sizeof(stream));
+		if (inflateInit(&stream) != Z_OK) throw std::runtime_error("zlib failed to start decompressing");
+		stream.next_out = reinterpret_cast< Bytef * >(to);
+		stream.avail_out = uInt(to_size);
+
+		char buffer[16384];
+		int result = Z_OK;
+		while (result == Z_OK) {
+			if (stream.avail_in == 0 && from_size > 0) {
+				size_t count = std::min(from_size, sizeof(buffer));
+				if (!from.read(buffer, count)) {
+					inflateEnd(&stream);
+					throw std::runtime_error("Failed to read compressed chunk data.");
+				}
+				from_size -= count;
+				stream.next_in = reinterpret_cast< Bytef * >(buffer);
+				stream.avail_in = uInt(count);
+			}
+			result = inflate(&stream, Z_NO_FLUSH);
+			if (result == Z_BUF_ERROR && stream.avail_in == 0 && from_size == 0) break;
+		}
+		bool ok = (result == Z_STREAM_END && stream.total_out == to_size && stream.avail_in == 0 && from_size == 0);
+		inflateEnd(&stream);
+		if (!ok) throw std::runtime_error("zlib failed to decompress chunk");
+	} else if (codec == ChunkRaw) {
+		if (from_size != to_size) throw std::runtime_error("Raw chunk is the wrong size");
+		if (!from.read(reinterpret_cast< char * >(to), to_size)) {
+			throw std::runtime_error("Failed to read chunk data.");
+		}
+	} else {
+		//(the LZ decoder wants all of its input at once; the output still isn't copied)
+		std::vector< char > compressed(from_size);
+		if (!from.read(compressed.data(), from_size)) {
+			throw std::runtime_error("Failed to read compressed chunk data.");
+		}
+		decompress_chunk(codec, compressed.data(), compressed.size(), to, to_size);
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Compression for chunks (see read_write_chunk.hpp).
+ *
+ * Two codecs are available:
+ *  - ChunkZlib: zlib's deflate (smaller; zlib is already linked for libpng)
+ *  - ChunkLZ: a simple LZ77 byte codec in the style of LZ4 (larger, but much faster to decode)
+ *
+ * Decompression always writes straight into the caller's buffer.
+ */
+
+enum ChunkCodec : uint32_t {
+	ChunkRaw = 0,
+	ChunkZlib = 1,
+	ChunkLZ = 2,
+};
+
+//"raw", "zlib", or "lz" (throws on anything else):
+ChunkCodec chunk_codec(std::string const &name);
+char const *chunk_codec_name(ChunkCodec codec);
+
+//compress 'size' bytes:
+std::vector< char > compress_chunk(ChunkCodec codec, void const *data, size_t size);
+
+//decompress exactly 'to_size' bytes into 'to' from 'from_size' compressed bytes:
+//NOTE: these throw on malformed data
+void decompress_chunk(ChunkCodec codec, void const *from, size_t from_size, void *to, size_t to_size);
+// (...reading the compressed bytes from a stream as they are needed)
+void decompress_chunk(ChunkCodec codec, std::istream &from, size_t from_size, void *to, size_t to_size);
@@ -1,62 +1,218 @@
 #include "gl_compile_program.hpp"
 
+#include "gl_extensions.hpp"
+#include "read_write_chunk.hpp"
+#include "data_path.hpp"
+
 #include <vector>
 #include <string>
 #include <stdexcept>
 #include <iostream>
+#include <fstream>
+#include <cstring>
+#include <unordered_map>
+
+//print a shader's (or program's) info log to std::cerr:
+static void print_info_log(GLuint object, bool is_program) {
+	GLint info_log_length = 0;
+	if (is_program) glGetProgramiv(object, GL_INFO_LOG_LENGTH, &info_log_length);
+	else glGetShaderiv(object, GL_INFO_LOG_LENGTH, &info_log_length);
+	std::vector< GLchar > info_log(info_log_length + 1, 0);
+	GLsizei length = 0;
+	if (is_program) glGetProgramInfoLog(object, GLint(info_log.size()), &length, &info_log[0]);
+	else glGetShaderInfoLog(object, GLint(info_log.size()), &length, &info_log[0]);
+	std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
+}
 
-static GLuint gl_compile_shader(GLenum type, std::string const &source) {
+//start compiling a shader: (the status is checked by gl_finish_program, once the driver is done)
+static GLuint gl_start_shader(GLenum type, std::string const &source) {
 	GLuint shader = glCreateShader(type);
 	GLchar const *str = source.c_str();
 	GLint length = GLint(source.size());
 	glShaderSource(shader, 1, &str, &length);
 	glCompileShader(shader);
-	GLint compile_status = GL_FALSE;
-	glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
-	if (compile_status != GL_TRUE) {
-		std::cerr << "Failed to compile shader." << std::endl;
-		GLint info_log_length = 0;
-		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &info_log_length);
-		std::vector< GLchar > info_log(info_log_length, 0);
-		GLsizei length = 0;
-		glGetShaderInfoLog(shader, GLint(info_log.size()), &length, &info_log[0]);
-		std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
-		glDeleteShader(shader);
-		throw std::runtime_error("Failed to compile shader.");
-	}
 	return shader;
 }
 
+//Linked program binaries from earlier runs (when the driver supports ARB_get_program_binary):
+// stored in shaders.cache (next to the executable) as one "prog" chunk per program, each:
+// |key (8 bytes)|binary format (4 bytes)|binary...|
+// The key hashes the shader sources along with the GL vendor, renderer, and version strings,
+// so a new driver (or new shader code) just misses the cache.
+namespace {
+	struct ProgramCache {
+		struct Entry {
+			GLenum format = 0;
+			std::vector< char > binary;
+		};
+		std::unordered_map< uint64_t, Entry > entries;
+
+		std::string path() const { return data_path("shaders.cache"); }
+
+		ProgramCache() {
+			std::ifstream file(path(), std::ios::binary);
+			if (!file) return; //(no cache yet)
+			try {
+				while (file.peek() != std::char_traits< char >::eof()) {
+					std::vector< char > data;
+					read_chunk(file, "prog", &data);
+					if (data.size() < 12) throw std::runtime_error("entry is truncated");
+					uint64_t key;
+					Entry entry;
+					std::memcpy(&key, data.data(), 8);
+					std::memcpy(&entry.format, data.data() + 8, 4);
+					entry.binary.assign(data.begin() + 12, data.end());
+					entries[key] = std::move(entry);
+				}
+			} catch (std::exception &e) {
+				std::cerr << "NOTE: ignoring shader cache '" << path() << "' (" << e.what() << ")." << std::endl;
+				entries.clear();
+			}
+		}
+
+		void save() const {
+			std::ofstream file(path(), std::ios::binary);
+			for (auto const &kv : entries) {
+				std::vector< char > data(12 + kv.second.binary.size());
+				std::memcpy(data.data(), &kv.first, 8);
+				std::memcpy(data.data() + 8, &kv.second.format, 4);
+				if (!kv.second.binary.empty()) std::memcpy(data.data() + 12, kv.second.binary.data(), kv.second.binary.size());
+				write_chunk("prog", data, &file);
+			}
+			if (!file) std::cerr << "NOTE: couldn't write shader cache '" << path() << "'." << std::endl;
+		}
+	};
+
+	ProgramCache &program_cache() {
+		static ProgramCache cache;
+		return cache;
+	}
+
+	//64-bit FNV-1a hash (pass a previous hash to continue hashing):
+	uint64_t hash_string(std::string const &str, uint64_t hash = 0xcbf29ce484222325ULL) {
+		for (char c : str) {
+			hash = (hash ^ uint8_t(c)) * 0x100000001b3ULL;
+		}
+		return (hash ^ 0xff) * 0x100000001b3ULL; //(separator, so "ab"+"c" differs from "a"+"bc")
+	}
+
+	std::string gl_string(GLenum name) {
+		char const *str = reinterpret_cast< char const * >(glGetString(name));
+		return str ? str : "";
+	}
+}
+
 GLuint gl_compile_program(
 	std::string const &vertex_shader_source,
 	std::string const &fragment_shader_source
 	) {
+	return gl_finish_program(gl_start_program(vertex_shader_source, fragment_shader_source));
+}
 
-	GLuint vertex_shader = gl_compile_shader(GL_VERTEX_SHADER, vertex_shader_source);
-	GLuint fragment_shader = gl_compile_shader(GL_FRAGMENT_SHADER, fragment_shader_source);
+GLProgramBuild gl_start_program(
+	std::string const &vertex_shader_source,
+	std::string const &fragment_shader_source
+	) {
+
+	GLExtensions const &ext = gl_extensions();
+	GLProgramBuild build;
+
+	//try the cached binary of this program first:
+	if (ext.program_binary) {
+		build.cache_key = hash_string("shaders.cache v1");
+		build.cache_key = hash_string(gl_string(GL_VENDOR), build.cache_key);
+		build.cache_key = hash_string(gl_string(GL_RENDERER), build.cache_key);
+		build.cache_key = hash_string(gl_string(GL_VERSION), build.cache_key);
+		build.cache_key = hash_string(vertex_shader_source, build.cache_key);
+		build.cache_key = hash_string(fragment_shader_source, build.cache_key);
 
-	GLuint program = glCreateProgram();
-	glAttachShader(program, vertex_shader);
-	glAttachShader(program, fragment_shader);
+		auto &cache = program_cache();
+		auto f = cache.entries.find(build.cache_key);
+		if (f != cache.entries.end()) {
+			build.program = glCreateProgram();
+			ext.ProgramBinary(build.program, f->second.format, f->second.binary.data(), GLsizei(f->second.binary.size()));
+			GLint link_status = GL_FALSE;
+			glGetProgramiv(build.program, GL_LINK_STATUS, &link_status);
+			if (link_status == GL_TRUE) return build;
+
+			//driver rejected the binary; forget it and compile from source:
+			glDeleteProgram(build.program);
+			while (glGetError() != GL_NO_ERROR) { } //(e.g., GL_INVALID_ENUM for a format it no longer supports)
+			cache.entries.erase(f);
+		}
+	}
+
+	build.vertex_shader = gl_start_shader(GL_VERTEX_SHADER, vertex_shader_source);
+	build.fragment_shader = gl_start_shader(GL_FRAGMENT_SHADER, fragment_shader_source);
+
+	build.program = glCreateProgram();
+	glAttachShader(build.program, build.vertex_shader);
+	glAttachShader(build.program, build.fragment_shader);
 
 	//shaders are reference counted so this makes sure they are freed after program is deleted:
-	glDeleteShader(vertex_shader);
-	glDeleteShader(fragment_shader);
+	// (their names stay valid while they are attached, so gl_finish_program can still check them)
+	glDeleteShader(build.vertex_shader);
+	glDeleteShader(build.fragment_shader);
+
+	//ask the driver to keep the binary around, so it can be cached:
+	if (ext.program_binary) {
+		ext.ProgramParameteri(build.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
 
-	//link the shader program and throw errors if linking fails:
-	glLinkProgram(program);
+	//without KHR_parallel_shader_compile, the driver may well finish compiling (and linking) right here:
+	glLinkProgram(build.program);
+
+	return build;
+}
+
+bool gl_program_ready(GLProgramBuild const &build) {
+	if (!gl_extensions().parallel_shader_compile) return true;
+	GLint completion_status = GL_FALSE;
+	glGetProgramiv(build.program, GL_COMPLETION_STATUS_KHR, &completion_status);
+	return completion_status == GL_TRUE;
+}
+
+GLuint gl_finish_program(GLProgramBuild const &build) {
+	if (build.vertex_shader == 0) return build.program; //(came from the cache, already linked)
+
+	//throw errors if compiling or linking failed: (these wait on the driver, if it is still working)
 	GLint link_status = GL_FALSE;
-	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+	glGetProgramiv(build.program, GL_LINK_STATUS, &link_status);
 	if (link_status != GL_TRUE) {
+		for (GLuint shader : {build.vertex_shader, build.fragment_shader}) {
+			GLint compile_status = GL_FALSE;
+			glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
+			if (compile_status != GL_TRUE) {
+				std::cerr << "Failed to compile shader." << std::endl;
+				print_info_log(shader, false);
+				glDeleteProgram(build.program);
+				throw std::runtime_error("Failed to compile shader.");
+			}
+		}
 		std::cerr << "Failed to link shader program." << std::endl;
-		GLint info_log_length = 0;
-		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &info_log_length);
-		std::vector< GLchar > info_log(info_log_length, 0);
-		GLsizei length = 0;
-		glGetProgramInfoLog(program, GLint(info_log.size()), &length, &info_log[0]);
-		std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
+		print_info_log(build.program, true);
+		glDeleteProgram(build.program);
 		throw std::runtime_error("failed to link program");
 	}
 
-	return program;
+	//save the linked binary for next time:
+	if (build.cache_key != 0) {
+		GLExtensions const &ext = gl_extensions();
+		GLint binary_length = 0;
+		glGetProgramiv(build.program, GL_PROGRAM_BINARY_LENGTH, &binary_length);
+		if (binary_length > 0) {
+			ProgramCache::Entry entry;
+			entry.binary.resize(size_t(binary_length));
+			GLsizei length = 0;
+			ext.GetProgramBinary(build.program, binary_length, &length, &entry.format, entry.binary.data());
+			if (length > 0) {
+				entry.binary.resize(size_t(length));
+				auto &cache = program_cache();
+				cache.entries[build.cache_key] = std::move(entry);
+				cache.save();
+			}
+		}
+	}
+
+	return build.program;
 }
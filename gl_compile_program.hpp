@@ -3,9 +3,30 @@
 #include "GL.hpp"
 
 #include <string>
+#include <cstdint>
 
 //compiles+links an OpenGL shader program from source.
 // throws on compilation error.
 GLuint gl_compile_program(
 	std::string const &vertex_shader_source,
 	std::string const &fragment_shader_source);
+
+//...or in steps, so the driver can compile in the background (with KHR_parallel_shader_compile)
+// while the program does other things -- start every program first, then finish them:
+struct GLProgramBuild {
+	GLuint program = 0;
+	GLuint vertex_shader = 0, fragment_shader = 0; //(0 if the program came from the shader cache)
+	uint64_t cache_key = 0; //(0 if programs aren't being cached)
+};
+
+//hand the sources to the driver (doesn't wait for compiling or linking to finish):
+GLProgramBuild gl_start_program(
+	std::string const &vertex_shader_source,
+	std::string const &fragment_shader_source);
+
+//has the driver finished compiling+linking? (never waits; always true without KHR_parallel_shader_compile)
+bool gl_program_ready(GLProgramBuild const &build);
+
+//wait for the driver (if needed) and return the linked program.
+// throws on compilation error.
+GLuint gl_finish_program(GLProgramBuild const &build);
@@ -0,0 +1,92 @@
+#include "gl_errors.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+static char const *debug_source_name(GLenum source) {
+	switch (source) {
+		case GL_DEBUG_SOURCE_API: return "api";
+		case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window system";
+		case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+		case GL_DEBUG_SOURCE_THIRD_PARTY: return "third party";
+		case GL_DEBUG_SOURCE_APPLICATION: return "application";
+		default: return "other";
+	}
+}
+
+static char const *debug_type_name(GLenum type) {
+	switch (type) {
+		case GL_DEBUG_TYPE_ERROR: return "error";
+		case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+		case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behavior";
+		case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+		case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+		default: return "other";
+	}
+}
+
+static char const *debug_severity_name(GLenum severity) {
+	switch (severity) {
+		case GL_DEBUG_SEVERITY_HIGH: return "high";
+		case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+		case GL_DEBUG_SEVERITY_LOW: return "low";
+		default: return "notification";
+	}
+}
+
+static void APIENTRY debug_message(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, GLchar const *message, void const *) {
+	std::cerr << (type == GL_DEBUG_TYPE_ERROR ? "WARNING: gl error" : "NOTE: gl message")
+	          << " (" << debug_source_name(source) << ", " << debug_type_name(type) << ", " << debug_severity_name(severity) << ", id " << id << "): "
+	          << std::string(message, length < 0 ? std::strlen(message) : size_t(length)) << std::endl;
+}
+
+//severities, least severe first:
+static const GLenum Severities[] = {
+	GL_DEBUG_SEVERITY_NOTIFICATION,
+	GL_DEBUG_SEVERITY_LOW,
+	GL_DEBUG_SEVERITY_MEDIUM,
+	GL_DEBUG_SEVERITY_HIGH,
+};
+
+bool gl_debug_output(GLenum min_severity, std::vector< GLenum > const &sources) {
+	if (std::find(std::begin(Severities), std::end(Severities), min_severity) == std::end(Severities)) {
+		throw std::runtime_error("gl_debug_output: unknown severity " + std::to_string(min_severity) + ".");
+	}
+
+	GLExtensions const &ext = gl_extensions();
+	if (!ext.debug_output) return false;
+
+	//ARB_debug_output (unlike KHR_debug) only sends messages from a debug context, and the driver
+	// doesn't have to give us one just because we asked; without one, stick with glGetError():
+	if (!ext.debug_output_enable) {
+		GLint flags = 0;
+		glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+		if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT)) return false;
+	}
+
+	if (ext.debug_output_enable) glEnable(GL_DEBUG_OUTPUT);
+	glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	ext.DebugMessageCallback(debug_message, nullptr);
+
+	//the driver does the filtering, so filtered-out messages cost nothing:
+	// (turn everything off, then turn the requested sources + severities back on)
+	ext.DebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_FALSE);
+	std::vector< GLenum > enable = sources;
+	if (enable.empty()) enable.emplace_back(GL_DONT_CARE);
+	bool at_or_above = false;
+	for (GLenum severity : Severities) {
+		if (severity == min_severity) at_or_above = true;
+		if (!at_or_above) continue;
+		for (GLenum source : enable) {
+			ext.DebugMessageControl(source, GL_DONT_CARE, severity, 0, nullptr, GL_TRUE);
+		}
+	}
+
+	//(anything that went wrong before now still needs to be reported the old way)
+	gl_errors("before gl_debug_output");
+
+	gl_debug_output_active() = true;
+	return true;
+}
@@ -1,7 +1,27 @@
 #pragma once
 
-#include "GL.hpp"
+/*
+ * GL_ERRORS() checks for (and prints) OpenGL errors, but only in debug builds:
+ *  in release builds (NDEBUG defined, as by 'jam -sRELEASE=1') it compiles to nothing,
+ *  since glGetError() can stall the pipeline. (Define GL_DEBUG as 0 or 1 to choose directly.)
+ *
+ * In debug builds, call gl_debug_output() once the context exists to have the driver report errors
+ *  (and warnings) through a KHR_debug callback as they happen; after that, GL_ERRORS() skips glGetError().
+ *
+ */
+
+#include "gl_extensions.hpp" //(GL.hpp, plus the KHR_debug values)
 #include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef GL_DEBUG
+#ifdef NDEBUG
+#define GL_DEBUG 0
+#else
+#define GL_DEBUG 1
+#endif
+#endif
 
 #define STR2(X) # X
 #define STR(X) STR2(X)
@@ -27,5 +47,23 @@ inline void gl_errors(std::string const &where) {
 		#undef CHECK
 	}
 }
-#define GL_ERRORS() gl_errors(__FILE__  ":" STR(__LINE__) )
+
+//Report OpenGL messages from 'sources' (all, if empty) at or above 'min_severity'
+// (GL_DEBUG_SEVERITY_NOTIFICATION, _LOW, _MEDIUM, or _HIGH) to std::cerr as the driver sends them:
+// (messages are synchronous, so a breakpoint in the callback shows the call that caused them)
+// returns false if the driver doesn't have KHR_debug or ARB_debug_output
+// (or only has ARB_debug_output, and the context isn't a debug context).
+bool gl_debug_output(GLenum min_severity, std::vector< GLenum > const &sources = {});
+
+//has gl_debug_output() been set up? (then GL_ERRORS() has nothing to do)
+inline bool &gl_debug_output_active() {
+	static bool active = false;
+	return active;
+}
+
+#if GL_DEBUG
+#define GL_ERRORS() do { if (!gl_debug_output_active()) gl_errors(__FILE__  ":" STR(__LINE__) ); } while (0)
+#else
+#define GL_ERRORS() do { } while (0)
+#endif
 
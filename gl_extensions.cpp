@@ -0,0 +1,64 @@
+#include "gl_extensions.hpp"
+
+#include <SDL.h>
+
+#include <cstring>
+
+bool gl_has_extension(char const *name) {
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; ++i) {
+		char const *extension = reinterpret_cast< char const * >(glGetStringi(GL_EXTENSIONS, GLuint(i)));
+		if (extension && std::strcmp(extension, name) == 0) return true;
+	}
+	return false;
+}
+
+//look up 'fn' into 'ptr'; false if the driver doesn't have it:
+template< typename FN >
+static bool lookup(FN *ptr, char const *fn) {
+	*ptr = reinterpret_cast< FN >(SDL_GL_GetProcAddress(fn));
+	return *ptr != nullptr;
+}
+
+GLExtensions const &gl_extensions() {
+	static GLExtensions extensions = [](){
+		GLExtensions ext;
+
+		GLint major = 0, minor = 0;
+		glGetIntegerv(GL_MAJOR_VERSION, &major);
+		glGetIntegerv(GL_MINOR_VERSION, &minor);
+		bool version_4_1 = (major > 4 || (major == 4 && minor >= 1));
+
+		if (version_4_1 || gl_has_extension("GL_ARB_get_program_binary")) {
+			GLint formats = 0;
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+			ext.program_binary = formats > 0
+				&& lookup(&ext.GetProgramBinary, "glGetProgramBinary")
+				&& lookup(&ext.ProgramBinary, "glProgramBinary")
+				&& lookup(&ext.ProgramParameteri, "glProgramParameteri");
+		}
+
+		if (gl_has_extension("GL_KHR_parallel_shader_compile")) {
+			ext.parallel_shader_compile = lookup(&ext.MaxShaderCompilerThreads, "glMaxShaderCompilerThreadsKHR");
+		} else if (gl_has_extension("GL_ARB_parallel_shader_compile")) {
+			ext.parallel_shader_compile = lookup(&ext.MaxShaderCompilerThreads, "glMaxShaderCompilerThreadsARB");
+		}
+		if (ext.parallel_shader_compile) {
+			//let the driver use as many threads as it likes: (the ARB version defaults to none)
+			ext.MaxShaderCompilerThreads(0xffffffff);
+		}
+
+		if (major > 4 || (major == 4 && minor >= 3) || gl_has_extension("GL_KHR_debug")) {
+			ext.debug_output = lookup(&ext.DebugMessageCallback, "glDebugMessageCallback")
+				&& lookup(&ext.DebugMessageControl, "glDebugMessageControl");
+			ext.debug_output_enable = ext.debug_output;
+		} else if (gl_has_extension("GL_ARB_debug_output")) {
+			ext.debug_output = lookup(&ext.DebugMessageCallback, "glDebugMessageCallbackARB")
+				&& lookup(&ext.DebugMessageControl, "glDebugMessageControlARB");
+		}
+
+		return ext;
+	}();
+	return extensions;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+/*
+ * OpenGL extensions (beyond the 3.3 core in GL.hpp) that are used when the driver has them.
+ *
+ * gl_extensions() looks them up the first time it is called, so call it first on the
+ *  thread with the OpenGL context (after init_GL()). Check the 'bool' for an extension
+ *  before calling any of its functions.
+ *
+ */
+
+#include "GL.hpp"
+
+//is extension 'name' (e.g., "GL_ARB_get_program_binary") supported by the current context?
+bool gl_has_extension(char const *name);
+
+//ARB_get_program_binary (core in 4.1):
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH          0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS     0x87FE
+#define GL_PROGRAM_BINARY_FORMATS         0x87FF
+#endif
+
+//KHR_parallel_shader_compile (or ARB_parallel_shader_compile; same values):
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR           0x91B1
+#endif
+
+//KHR_debug (core in 4.3) or ARB_debug_output (same values):
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS       0x8242
+#define GL_DEBUG_SOURCE_API               0x8246
+#define GL_DEBUG_SOURCE_WINDOW_SYSTEM     0x8247
+#define GL_DEBUG_SOURCE_SHADER_COMPILER   0x8248
+#define GL_DEBUG_SOURCE_THIRD_PARTY       0x8249
+#define GL_DEBUG_SOURCE_APPLICATION       0x824A
+#define GL_DEBUG_SOURCE_OTHER             0x824B
+#define GL_DEBUG_TYPE_ERROR               0x824C
+#define GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR 0x824D
+#define GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR  0x824E
+#define GL_DEBUG_TYPE_PORTABILITY         0x824F
+#define GL_DEBUG_TYPE_PERFORMANCE         0x8250
+#define GL_DEBUG_TYPE_OTHER               0x8251
+#define GL_DEBUG_SEVERITY_HIGH            0x9146
+#define GL_DEBUG_SEVERITY_MEDIUM          0x9147
+#define GL_DEBUG_SEVERITY_LOW             0x9148
+#define GL_DEBUG_SEVERITY_NOTIFICATION    0x826B
+#define GL_DEBUG_OUTPUT                   0x92E0
+#endif
+
+//(ARB_debug_output only promises messages in a context with this flag set:)
+#ifndef GL_CONTEXT_FLAG_DEBUG_BIT
+#define GL_CONTEXT_FLAG_DEBUG_BIT         0x00000002
+#endif
+
+struct GLExtensions {
+	//ARB_get_program_binary (with at least one binary format):
+	bool program_binary = false;
+	void (APIENTRY *GetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) = nullptr;
+	void (APIENTRY *ProgramBinary)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) = nullptr;
+	void (APIENTRY *ProgramParameteri)(GLuint program, GLenum pname, GLint value) = nullptr;
+
+	//KHR_parallel_shader_compile (or ARB_parallel_shader_compile):
+	// (if true, GL_COMPLETION_STATUS_KHR can be queried without waiting on the driver)
+	bool parallel_shader_compile = false;
+	void (APIENTRY *MaxShaderCompilerThreads)(GLuint count) = nullptr;
+
+	//KHR_debug (or ARB_debug_output):
+	bool debug_output = false;
+	bool debug_output_enable = false; //(KHR_debug only: output also needs glEnable(GL_DEBUG_OUTPUT))
+	typedef void (APIENTRY *DebugProc)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *userParam);
+	void (APIENTRY *DebugMessageCallback)(DebugProc callback, const void *userParam) = nullptr;
+	void (APIENTRY *DebugMessageControl)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) = nullptr;
+};
+
+GLExtensions const &gl_extensions();
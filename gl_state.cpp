@@ -0,0 +1,98 @@
+#include "gl_state.hpp"
+
+#include <cassert>
+
+constexpr uint32_t GLState::TextureUnits;
+
+void GLState::viewport(glm::ivec4 const &xywh) {
+	if (change(current.viewport, xywh)) glViewport(xywh.x, xywh.y, xywh.z, xywh.w);
+}
+
+glm::ivec4 GLState::get_viewport() {
+	if (current.viewport.known) {
+		counts.queries_elided += 1;
+	} else {
+		GLint xywh[4];
+		glGetIntegerv(GL_VIEWPORT, xywh);
+		current.viewport.value = glm::ivec4(xywh[0], xywh[1], xywh[2], xywh[3]);
+		current.viewport.known = true;
+	}
+	return current.viewport.value;
+}
+
+void GLState::clear_color(glm::vec4 const &rgba) {
+	if (change(current.clear_color, rgba)) glClearColor(rgba.r, rgba.g, rgba.b, rgba.a);
+}
+
+void GLState::bind_framebuffer(GLenum target, GLuint framebuffer) {
+	if (target == GL_FRAMEBUFFER) {
+		//(binds both; only worth a call if either one changes)
+		Known< GLuint > &read = current.read_framebuffer, &draw = current.draw_framebuffer;
+		if (read.known && read.value == framebuffer && draw.known && draw.value == framebuffer) {
+			counts.elided += 1;
+			return;
+		}
+		read.value = draw.value = framebuffer;
+		read.known = draw.known = true;
+		counts.calls += 1;
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	} else if (target == GL_READ_FRAMEBUFFER) {
+		if (change(current.read_framebuffer, framebuffer)) glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	} else {
+		assert(target == GL_DRAW_FRAMEBUFFER);
+		if (change(current.draw_framebuffer, framebuffer)) glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+	}
+}
+
+void GLState::use_program(GLuint program) {
+	if (change(current.program, program)) glUseProgram(program);
+}
+
+void GLState::bind_vertex_array(GLuint vertex_array) {
+	if (change(current.vertex_array, vertex_array)) glBindVertexArray(vertex_array);
+}
+
+void GLState::bind_array_buffer(GLuint buffer) {
+	if (change(current.array_buffer, buffer)) glBindBuffer(GL_ARRAY_BUFFER, buffer);
+}
+
+void GLState::active_texture(uint32_t unit) {
+	if (change(current.active_texture, unit)) glActiveTexture(GL_TEXTURE0 + unit);
+}
+
+void GLState::bind_texture_2d(uint32_t unit, GLuint texture) {
+	assert(unit < TextureUnits);
+	//(leaves 'unit' active even if the texture was already bound, since callers may go on to glTexImage2D)
+	active_texture(unit);
+	if (change(current.texture_2d[unit], texture)) glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void GLState::blend(bool enabled) {
+	if (change(current.blend, enabled)) {
+		if (enabled) glEnable(GL_BLEND);
+		else glDisable(GL_BLEND);
+	}
+}
+
+void GLState::blend_equation(GLenum mode) {
+	if (change(current.blend_equation, mode)) glBlendEquation(mode);
+}
+
+void GLState::blend_func(GLenum sfactor, GLenum dfactor) {
+	if (change(current.blend_func, glm::uvec2(sfactor, dfactor))) glBlendFunc(sfactor, dfactor);
+}
+
+void GLState::forget() {
+	current = Current();
+}
+
+GLState::Counts GLState::end_frame() {
+	Counts frame = counts;
+	counts = Counts();
+	return frame;
+}
+
+GLState &gl_state() {
+	static GLState state;
+	return state;
+}
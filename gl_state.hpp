@@ -0,0 +1,96 @@
+#pragma once
+
+/*
+ * A CPU-side copy of the OpenGL state that gets changed every frame (bindings, viewport, blending),
+ *  so that setting state to what it already is doesn't cost a call into the driver, and
+ *  reading it back (e.g., the viewport) doesn't cost a glGet round trip.
+ *
+ * Everything starts out unknown, so the first change of each thing is always passed on to OpenGL.
+ * Code that changes this state *without* going through gl_state() -- e.g., a constructor that
+ *  binds things with raw glBind* calls to set up an object -- must call gl_state().forget() afterward,
+ *  since it may run in the middle of a frame (a LoadOnUse Load<>, say), and later draws would
+ *  otherwise skip binds they think are already in place. main() also calls forget() after loading.
+ *  (So should code that deletes objects that might be bound, since deleting unbinds them.)
+ *
+ * Only use gl_state() from the thread with the OpenGL context.
+ *
+ */
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+
+struct GLState {
+	//viewport (glViewport):
+	void viewport(glm::ivec4 const &xywh);
+	glm::ivec4 get_viewport(); //(only queries OpenGL if the viewport isn't known)
+
+	//clear color (glClearColor):
+	void clear_color(glm::vec4 const &rgba);
+
+	//bindings:
+	void bind_framebuffer(GLenum target, GLuint framebuffer); //(GL_FRAMEBUFFER, GL_READ_FRAMEBUFFER, or GL_DRAW_FRAMEBUFFER)
+	void use_program(GLuint program);
+	void bind_vertex_array(GLuint vertex_array);
+	void bind_array_buffer(GLuint buffer); //(GL_ARRAY_BUFFER binding)
+	void bind_texture_2d(uint32_t unit, GLuint texture); //(unit < TextureUnits; also makes 'unit' the active unit)
+	void active_texture(uint32_t unit); //(before other calls that use the active unit)
+
+	//blending (glEnable/glDisable(GL_BLEND), glBlendEquation, glBlendFunc):
+	void blend(bool enabled);
+	void blend_equation(GLenum mode);
+	void blend_func(GLenum sfactor, GLenum dfactor);
+
+	//mark everything as unknown (call after changing state without gl_state()):
+	void forget();
+
+	//what the calls above did since the last end_frame():
+	struct Counts {
+		uint32_t calls = 0; //passed on to OpenGL
+		uint32_t elided = 0; //dropped because the state was already set
+		uint32_t queries_elided = 0; //glGet calls answered from the copy
+	};
+	Counts counts;
+	//returns (and resets) 'counts' -- call once per frame:
+	Counts end_frame();
+
+	static constexpr uint32_t TextureUnits = 16; //texture units tracked by bind_texture_2d
+
+	//a bit of state and whether it is known:
+	template< typename T >
+	struct Known {
+		T value = T();
+		bool known = false;
+	};
+	//returns true (and updates 'state') if 'value' is a change; counts an elided call if not:
+	template< typename T >
+	bool change(Known< T > &state, T const &value) {
+		if (state.known && state.value == value) {
+			counts.elided += 1;
+			return false;
+		}
+		state.value = value;
+		state.known = true;
+		counts.calls += 1;
+		return true;
+	}
+
+	//the state as far as gl_state() knows:
+	struct Current {
+		Known< glm::ivec4 > viewport;
+		Known< glm::vec4 > clear_color;
+		Known< GLuint > read_framebuffer, draw_framebuffer;
+		Known< GLuint > program;
+		Known< GLuint > vertex_array;
+		Known< GLuint > array_buffer;
+		Known< uint32_t > active_texture;
+		std::array< Known< GLuint >, TextureUnits > texture_2d;
+		Known< bool > blend;
+		Known< GLenum > blend_equation;
+		Known< glm::uvec2 > blend_func;
+	} current;
+};
+
+GLState &gl_state();
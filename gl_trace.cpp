@@ -0,0 +1,120 @@
+#include "gl_trace.hpp"
+
+#include "GL.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#ifdef GL_TRACE
+
+namespace {
+	struct Totals {
+		uint64_t calls = 0;
+		uint64_t nanoseconds = 0;
+		uint64_t bytes = 0;
+	};
+	struct {
+		uint64_t frames = 0;
+		Totals entries[GLTraceEntries];
+		Totals frame; //(all entries, summed)
+		Totals worst; //frame with the most time in OpenGL
+	} totals;
+}
+
+uint64_t gl_trace_pixel_bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth) {
+	uint64_t components = 4;
+	switch (format) {
+		case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: components = 1; break;
+		case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL: components = 2; break;
+		case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER: components = 3; break;
+		default: components = 4; break;
+	}
+	uint64_t pixel = 4;
+	switch (type) {
+		case GL_UNSIGNED_BYTE: case GL_BYTE: pixel = components; break;
+		case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: pixel = 2 * components; break;
+		case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: pixel = 4 * components; break;
+		//packed types are one value per pixel:
+		case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV: pixel = 1; break;
+		case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+		case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+		case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV: pixel = 2; break;
+		case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: pixel = 8; break;
+		default: pixel = 4; break; //(the rest of the packed types are 32 bits)
+	}
+	return pixel * uint64_t(std::max(width, 0)) * uint64_t(std::max(height, 0)) * uint64_t(std::max(depth, 0));
+}
+
+void gl_trace_end_frame() {
+	Totals frame;
+	for (uint32_t i = 0; i < GLTraceEntries; ++i) {
+		GLTraceEntry &entry = gl_trace_entries[i];
+		totals.entries[i].calls += entry.calls;
+		totals.entries[i].nanoseconds += entry.nanoseconds;
+		totals.entries[i].bytes += entry.bytes;
+		frame.calls += entry.calls;
+		frame.nanoseconds += entry.nanoseconds;
+		frame.bytes += entry.bytes;
+		entry = GLTraceEntry();
+	}
+	totals.frames += 1;
+	totals.frame.calls += frame.calls;
+	totals.frame.nanoseconds += frame.nanoseconds;
+	totals.frame.bytes += frame.bytes;
+	if (frame.nanoseconds > totals.worst.nanoseconds) totals.worst = frame;
+}
+
+void gl_trace_reset() {
+	for (uint32_t i = 0; i < GLTraceEntries; ++i) {
+		gl_trace_entries[i] = GLTraceEntry();
+	}
+	totals = decltype(totals)();
+}
+
+void gl_trace_report(std::ostream &out, size_t max_lines) {
+	if (totals.frames == 0) {
+		out << "OpenGL calls: no frames traced.\n";
+		out.flush();
+		return;
+	}
+	double frames = double(totals.frames);
+
+	std::vector< uint32_t > slowest;
+	for (uint32_t i = 0; i < GLTraceEntries; ++i) {
+		if (totals.entries[i].calls) slowest.emplace_back(i);
+	}
+	std::stable_sort(slowest.begin(), slowest.end(), [](uint32_t a, uint32_t b) {
+		return totals.entries[a].nanoseconds > totals.entries[b].nanoseconds;
+	});
+
+	std::ios state(nullptr);
+	state.copyfmt(out);
+	out << std::fixed;
+	out << "OpenGL calls over " << totals.frames << " frames:\n"
+	    << "  per frame:   " << std::setprecision(1) << (totals.frame.calls / frames) << " calls, "
+	    << std::setprecision(3) << (totals.frame.nanoseconds / frames * 1e-6) << " ms, "
+	    << uint64_t(totals.frame.bytes / frames) << " bytes uploaded\n"
+	    << "  worst frame: " << totals.worst.calls << " calls, "
+	    << (totals.worst.nanoseconds * 1e-6) << " ms, "
+	    << totals.worst.bytes << " bytes uploaded\n";
+	for (size_t i = 0; i < slowest.size() && i < max_lines; ++i) {
+		Totals const &entry = totals.entries[slowest[i]];
+		out << "  " << std::setw(10) << std::setprecision(3) << (entry.nanoseconds / frames * 1e-6) << " ms  "
+		    << std::setw(8) << std::setprecision(1) << (entry.calls / frames) << " calls  "
+		    << std::setw(10) << uint64_t(entry.bytes / frames) << " bytes  "
+		    << gl_trace_names[slowest[i]] << "\n";
+	}
+	if (slowest.size() > max_lines) out << "  (and " << (slowest.size() - max_lines) << " more)\n";
+	out.copyfmt(state);
+	out.flush();
+}
+
+#else //GL_TRACE
+
+void gl_trace_end_frame() { }
+void gl_trace_reset() { }
+void gl_trace_report(std::ostream &, size_t) { }
+
+#endif //GL_TRACE
@@ -0,0 +1,23 @@
+#pragma once
+
+/*
+ * A per-frame OpenGL call budget, built on the tracing wrappers make-GL.py generates into GL.hpp/GL.cpp:
+ *  how many calls of each entry point a frame makes, how long they take, and how many bytes they upload.
+ *
+ * Tracing is only compiled in with GL_TRACE defined ('jam -sGL_TRACE=1'). Without it the wrappers
+ *  don't exist, gl* calls go straight to OpenGL, and these functions do nothing.
+ *
+ */
+
+#include <iosfwd>
+#include <cstddef>
+
+//fold the counts since the last call into the per-frame totals: (call once per frame)
+void gl_trace_end_frame();
+
+//forget all counts and totals (e.g., the calls made while loading):
+void gl_trace_reset();
+
+//print calls, time, and upload bytes per frame (average and worst frame),
+// then the entry points that took the most time per frame (at most 'max_lines' of them):
+void gl_trace_report(std::ostream &out, size_t max_lines = 10);
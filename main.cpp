@@ -3,6 +3,7 @@
 
 //The 'PlayMode' mode plays the game:
 #include "PlayMode.hpp"
+#include "PlaybackMode.hpp"
 
 //For asset loading:
 #include "Load.hpp"
@@ -10,8 +11,20 @@
 //GL.hpp will include a non-namespace-polluting set of opengl prototypes:
 #include "GL.hpp"
 
-//for screenshots:
-#include "load_save_png.hpp"
+//...and gl_state() tracks per-frame OpenGL state, to skip calls that don't change anything:
+#include "gl_state.hpp"
+
+//...and gl_errors.hpp decides whether this is a debug build (GL_DEBUG) for OpenGL error reporting:
+#include "gl_errors.hpp"
+
+//...and, in builds with GL_TRACE defined, gl_trace.hpp reports the per-frame OpenGL call budget:
+#include "gl_trace.hpp"
+
+//for screenshots (and saving every frame):
+#include "FrameCapture.hpp"
+
+//for recording PPU output:
+#include "PPUStream.hpp"
 
 //Includes for libSDL:
 #include <SDL.h>
@@ -34,7 +47,7 @@ int main(int argc, char **argv) {
 	//Initialize SDL library:
 	SDL_Init(SDL_INIT_VIDEO);
 
-	//Ask for an OpenGL context version 3.3, core profile, enable debug:
+	//Ask for an OpenGL context version 3.3, core profile, enable debug (in debug builds):
 	SDL_GL_ResetAttributes();
 	SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
 	SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
@@ -44,7 +57,9 @@ int main(int argc, char **argv) {
 	SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
 	SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+#if GL_DEBUG
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
+#endif
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
 
@@ -78,6 +93,13 @@ int main(int argc, char **argv) {
 	//On windows, load OpenGL entrypoints: (does nothing on other platforms)
 	init_GL();
 
+#if GL_DEBUG
+	//have the driver report errors and warnings as they happen (GL_ERRORS() falls back to glGetError() if it can't):
+	if (!gl_debug_output(GL_DEBUG_SEVERITY_LOW)) {
+		std::cerr << "NOTE: no KHR_debug (or ARB_debug_output in a debug context); using glGetError() to check for OpenGL errors." << std::endl;
+	}
+#endif
+
 	//Set VSYNC + Late Swap (prevents crazy FPS):
 	if (SDL_GL_SetSwapInterval(-1) != 0) {
 		std::cerr << "NOTE: couldn't set vsync + late swap tearing (" << SDL_GetError() << ")." << std::endl;
@@ -92,11 +114,27 @@ int main(int argc, char **argv) {
 	//------------ load assets --------------
 	call_load_functions();
 
+	//report what loading spent its time on:
+	// (run with LOAD_TRACE=some_file.json to also save a trace, for chrome://tracing or ui.perfetto.dev)
+	print_load_report(std::cout);
+	if (char const *trace = SDL_getenv("LOAD_TRACE")) {
+		write_load_trace(trace);
+		std::cout << "Wrote load trace to '" << trace << "'." << std::endl;
+	}
+
 	//------------ create game mode + make current --------------
-	Mode::set_current(std::make_shared< PlayMode >());
+	// (game --play recording.ppu plays back a recording instead)
+	if (argc == 3 && std::string(argv[1]) == "--play") {
+		Mode::set_current(std::make_shared< PlaybackMode >(argv[2]));
+	} else {
+		Mode::set_current(std::make_shared< PlayMode >());
+	}
 
 	//------------ main loop ------------
 
+	//loading functions set OpenGL state directly, so don't trust anything gl_state() thinks it knows:
+	gl_state().forget();
+
 	//this inline function will be called whenever the window is resized,
 	// and will update the window_size and drawable_size variables:
 	glm::uvec2 window_size; //size of window (layout pixels)
@@ -108,10 +146,20 @@ int main(int argc, char **argv) {
 		window_size = glm::uvec2(w, h);
 		SDL_GL_GetDrawableSize(window, &w, &h);
 		drawable_size = glm::uvec2(w, h);
-		glViewport(0, 0, drawable_size.x, drawable_size.y);
+		gl_state().viewport(glm::ivec4(0, 0, drawable_size.x, drawable_size.y));
 	};
 	on_resize();
 
+#ifdef GL_TRACE
+	gl_trace_reset(); //(only count calls made by frames, not by loading)
+#endif
+
+	//saves screenshots (and frame sequences) without stalling the game:
+	FrameCapture capture;
+
+	//total of gl_state()'s per-frame counts, reported at exit:
+	uint64_t frames = 0, gl_calls = 0, gl_elided = 0, gl_queries_elided = 0;
+
 	//This will loop until the current mode is set to null:
 	while (Mode::current) {
 		//every pass through the game loop creates one frame of output
@@ -131,19 +179,37 @@ int main(int argc, char **argv) {
 					Mode::set_current(nullptr);
 					break;
 				} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_PRINTSCREEN) {
-					// --- screenshot key ---
-					std::string filename = "screenshot.png";
-					std::cout << "Saving screenshot to '" << filename << "'." << std::endl;
-					glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
-					glReadBuffer(GL_FRONT);
-					int w,h;
-					SDL_GL_GetDrawableSize(window, &w, &h);
-					std::vector< glm::u8vec4 > data(w*h);
-					glReadPixels(0,0,w,h, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
-					for (auto &px : data) {
-						px.a = 0xff;
+					if (evt.key.keysym.mod & KMOD_SHIFT) {
+						// --- shift + screenshot key: start/stop saving every frame ---
+						if (capture.in_sequence()) {
+							capture.stop_sequence();
+							std::cout << "Stopped saving frames." << std::endl;
+						} else {
+							capture.start_sequence("capture-");
+							std::cout << "Saving every frame to 'capture-NNNNNN.png' (shift + print screen again to stop)." << std::endl;
+						}
+					} else {
+						// --- screenshot key ---
+						std::string filename = "screenshot.png";
+						std::cout << "Saving screenshot to '" << filename << "'." << std::endl;
+						capture.screenshot(filename); //(of the next frame drawn)
+					}
+				} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_F10) {
+					// --- record key: start/stop recording PPU output ---
+					if (PPUStreamWriter::current) {
+						std::cout << "Recorded " << PPUStreamWriter::current->frames << " frames to '" << PPUStreamWriter::current->filename << "'." << std::endl;
+						PPUStreamWriter::current.reset(); //(finishes writing)
+					} else {
+						std::string filename = "recording.ppu";
+						try {
+							PPUStreamWriter::current = std::make_shared< PPUStreamWriter >(filename);
+							std::cout << "Recording to '" << filename << "' (F10 again to stop; play back with 'game --play " << filename << "')." << std::endl;
+						} catch (std::exception &e) {
+							//(not being able to record shouldn't end the game)
+							std::cerr << "NOTE: couldn't start recording (" << e.what() << ")." << std::endl;
+							PPUStreamWriter::current.reset();
+						}
 					}
-					save_png(filename, glm::uvec2(w,h), data.data(), LowerLeftOrigin);
 				}
 			}
 			if (!Mode::current) break;
@@ -166,15 +232,41 @@ int main(int argc, char **argv) {
 		{ //(3) call the current mode's "draw" function to produce output:
 		
 			Mode::current->draw(drawable_size);
+
+			//read back this frame, if it's being saved:
+			capture.end_frame(drawable_size);
 		}
 
 		//Wait until the recently-drawn frame is shown before doing it all again:
 		SDL_GL_SwapWindow(window);
+
+		GLState::Counts counts = gl_state().end_frame();
+		gl_calls += counts.calls;
+		gl_elided += counts.elided;
+		gl_queries_elided += counts.queries_elided;
+		frames += 1;
+
+#ifdef GL_TRACE
+		gl_trace_end_frame();
+#endif
+	}
+
+	if (frames) {
+		std::cout << "OpenGL state changes per frame: " << double(gl_calls) / frames << " made, "
+		          << double(gl_elided) / frames << " elided, "
+		          << double(gl_queries_elided) / frames << " queries elided." << std::endl;
 	}
+#ifdef GL_TRACE
+	gl_trace_report(std::cout);
+#endif
 
 
 	//------------  teardown ------------
 
+	PPUStreamWriter::current.reset(); //(finish any recording)
+
+	capture.finish(); //(needs the context)
+
 	SDL_GL_DeleteContext(context);
 	context = 0;
 
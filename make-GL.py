@@ -8,6 +8,34 @@ import re
 filtered = []
 lookups = []
 fps = []
+functions = [] #(return type, name, arguments) for every entry point, for the tracing wrappers
+
+#bytes each upload call passes to OpenGL, for the tracing wrappers: (null data counts as zero bytes)
+upload_bytes = {
+	"glBufferData": "(data ? uint64_t(size) : 0)",
+	"glBufferSubData": "uint64_t(size)",
+	"glTexImage1D": "(pixels ? gl_trace_pixel_bytes(format, type, width, 1, 1) : 0)",
+	"glTexImage2D": "(pixels ? gl_trace_pixel_bytes(format, type, width, height, 1) : 0)",
+	"glTexImage3D": "(pixels ? gl_trace_pixel_bytes(format, type, width, height, depth) : 0)",
+	"glTexSubImage1D": "(pixels ? gl_trace_pixel_bytes(format, type, width, 1, 1) : 0)",
+	"glTexSubImage2D": "(pixels ? gl_trace_pixel_bytes(format, type, width, height, 1) : 0)",
+	"glTexSubImage3D": "(pixels ? gl_trace_pixel_bytes(format, type, width, height, depth) : 0)",
+	"glCompressedTexImage1D": "(data ? uint64_t(imageSize) : 0)",
+	"glCompressedTexImage2D": "(data ? uint64_t(imageSize) : 0)",
+	"glCompressedTexImage3D": "(data ? uint64_t(imageSize) : 0)",
+	"glCompressedTexSubImage1D": "(data ? uint64_t(imageSize) : 0)",
+	"glCompressedTexSubImage2D": "(data ? uint64_t(imageSize) : 0)",
+	"glCompressedTexSubImage3D": "(data ? uint64_t(imageSize) : 0)",
+}
+
+#"(GLenum target, const void *data);" -> "target, data"
+def argument_names(ag):
+	ag = ag.strip().rstrip(";").strip()
+	assert ag[0] == "(" and ag[-1] == ")"
+	ag = ag[1:-1].strip()
+	if ag == "void" or ag == "":
+		return ""
+	return ", ".join(re.search(r"(\w+)\s*$", a).group(1) for a in ag.split(","))
 
 with open('glcorearb.h', 'r') as f:
 	in_version = None
@@ -76,6 +104,8 @@ with open('glcorearb.h', 'r') as f:
 			#check for function prototype lines:
 			m = re.match(r"GLAPI(.*)APIENTRY ([^\s]+) (.*)$", line)
 			if m != None:
+				if mode != "skip":
+					functions.append((m.group(1).strip(), m.group(2), m.group(3)))
 				if mode == "all_proto":
 					filtered.append(line)
 				elif mode == "win_pointer":
@@ -151,11 +181,45 @@ typedef signed   long  int     khronos_ssize_t;
 	print("\n".join(filtered), file=f)
 
 	print("""
-}""", file=f)
+}
+
+#ifdef GL_TRACE
+//------ call tracing ------
+//When built with GL_TRACE defined ('jam -sGL_TRACE=1'), every gl* call above goes through a wrapper
+// that counts and times it, and tallies the bytes passed to upload calls; gl_trace.hpp reports them.
+//Without GL_TRACE, none of this exists (and calls go straight to OpenGL).
+
+struct GLTraceEntry {
+	uint32_t calls;
+	uint64_t nanoseconds;
+	uint64_t bytes; //(upload calls only)
+};
+
+enum GLTraceIndex : uint32_t {""", file=f)
+	print("\n".join("\tGLTrace_" + fn + "," for (rt, fn, ag) in functions), file=f)
+	print("""	GLTraceEntries //<-- just used to track # of entry points
+};
+
+//counts since gl_trace_end_frame() (see gl_trace.hpp), and entry point names:
+extern GLTraceEntry gl_trace_entries[GLTraceEntries];
+extern char const *gl_trace_names[GLTraceEntries];
+
+//bytes of (tightly packed) pixel data in a 'width' x 'height' x 'depth' upload, by 'format' and 'type':
+uint64_t gl_trace_pixel_bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth);
+""", file=f)
+	print("\n".join(rt + " APIENTRY gl_trace_" + fn + " " + ag for (rt, fn, ag) in functions), file=f)
+	print("""
+//(GL.cpp defines GL_TRACE_NO_MACROS, since its wrappers call the real functions)
+#ifndef GL_TRACE_NO_MACROS""", file=f)
+	print("\n".join("#define " + fn + " gl_trace_" + fn for (rt, fn, ag) in functions), file=f)
+	print("""#endif //GL_TRACE_NO_MACROS
+
+#endif //GL_TRACE""", file=f)
 
 
 with open("GL.cpp", "w") as f:
-	print("""#include "GL.hpp"
+	print("""#define GL_TRACE_NO_MACROS
+#include "GL.hpp"
 
 #include <SDL.h>
 #include <iostream>
@@ -176,4 +240,37 @@ void init_GL() {""", file=f)
 	print("""}
 #ifdef _WIN32""", file=f)
 	print("\t" + "\n\t".join(fps),file=f)
-	print("""#endif""", file=f)
+	print("""#endif
+
+#ifdef GL_TRACE
+#include <chrono>
+
+GLTraceEntry gl_trace_entries[GLTraceEntries];
+char const *gl_trace_names[GLTraceEntries] = {""", file=f)
+	print("\n".join("\t\"" + fn + "\"," for (rt, fn, ag) in functions), file=f)
+	print("""};
+
+namespace {
+	//counts (and times, until it goes out of scope) one call:
+	struct GLTraceCall {
+		GLTraceCall(GLTraceIndex index, uint64_t bytes = 0) : entry(gl_trace_entries[index]), start(std::chrono::steady_clock::now()) {
+			entry.calls += 1;
+			entry.bytes += bytes;
+		}
+		~GLTraceCall() {
+			entry.nanoseconds += uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+		}
+		GLTraceEntry &entry;
+		std::chrono::steady_clock::time_point start;
+	};
+}
+""", file=f)
+	for (rt, fn, ag) in functions:
+		print(rt + " APIENTRY gl_trace_" + fn + " " + ag.rstrip(";") + " {", file=f)
+		if fn in upload_bytes:
+			print("\tGLTraceCall call(GLTrace_" + fn + ", " + upload_bytes[fn] + ");", file=f)
+		else:
+			print("\tGLTraceCall call(GLTrace_" + fn + ");", file=f)
+		print("\treturn " + fn + "(" + argument_names(ag) + ");", file=f)
+		print("}", file=f)
+	print("""#endif //GL_TRACE""", file=f)
@@ -4,12 +4,27 @@
 #include <vector>
 #include <stdexcept>
 #include <cassert>
+#include <string>
+#include <cstring>
+
+#include <zlib.h> //for crc32()
+
+#include "chunk_compression.hpp"
 
 //helper function that reads an array of structures preceded by a simple header:
 //Expected format:
 // |ma|gi|c.|..| <-- four byte "magic number"
 // |sz|sz|sz|sz| <-- four byte (native endian) size
 // |TT...TT| * (sz/sizeof(TT)) <-- enough T structures to make up sz bytes
+//
+//Compressed chunks set the top bit of the size (ChunkCompressedBit), and start with:
+// |co|de|c.|..| <-- four byte ChunkCodec
+// |ra|w.|sz|..| <-- four byte size of the uncompressed data
+// |cm|p.|sz|..| <-- four byte size of the compressed data
+// |compressed data...| <-- followed by zero padding up to sz bytes (a multiple of four,
+//                          so that chunks after it stay aligned)
+//(read_chunk decompresses these straight into the destination vector)
+enum : uint32_t { ChunkCompressedBit = 0x80000000 };
 
 template< typename T >
 void read_chunk(std::istream &from, std::string const &magic, std::vector< T > *to_) {
@@ -30,6 +45,26 @@ void read_chunk(std::istream &from, std::string const &magic, std::vector< T > *
 		throw std::runtime_error("Unexpected magic number in chunk");
 	}
 
+	if (header.size & ChunkCompressedBit) {
+		uint32_t info[3]; //codec, uncompressed size, compressed size
+		uint32_t size = header.size & ~ChunkCompressedBit;
+		if (size < sizeof(info) || !from.read(reinterpret_cast< char * >(info), sizeof(info))) {
+			throw std::runtime_error("Failed to read compressed chunk header");
+		}
+		if (info[2] > size - sizeof(info)) {
+			throw std::runtime_error("Compressed chunk data is larger than its chunk");
+		}
+		if (info[1] % sizeof(T) != 0) {
+			throw std::runtime_error("Size of chunk not divisible by element size");
+		}
+		to.resize(info[1] / sizeof(T));
+		decompress_chunk(ChunkCodec(info[0]), from, info[2], to.data(), info[1]);
+		if (!from.ignore(size - sizeof(info) - info[2])) { //(skip padding)
+			throw std::runtime_error("Failed to read chunk data.");
+		}
+		return;
+	}
+
 	if (header.size % sizeof(T) != 0) {
 		throw std::runtime_error("Size of chunk not divisible by element size");
 	}
@@ -42,8 +77,9 @@ void read_chunk(std::istream &from, std::string const &magic, std::vector< T > *
 
 
 //helper function to write a chunk of data in the same format as read_chunk:
+// (optionally compressed with 'codec')
 template< typename T >
-void write_chunk(std::string const &magic, std::vector< T > const &from, std::ostream *to_) {
+void write_chunk(std::string const &magic, std::vector< T > const &from, std::ostream *to_, ChunkCodec codec = ChunkRaw) {
 	assert(magic.size() == 4);
 	assert(to_);
 	auto &to = *to_;
@@ -60,6 +96,70 @@ void write_chunk(std::string const &magic, std::vector< T > const &from, std::os
 	header.magic[3] = magic[3];
 	header.size = uint32_t(from.size() * sizeof(T));
 
+	if (codec != ChunkRaw) {
+		std::vector< char > compressed = compress_chunk(codec, from.data(), from.size() * sizeof(T));
+		uint32_t info[3] = { uint32_t(codec), header.size, uint32_t(compressed.size()) };
+		size_t padding = (4 - compressed.size() % 4) % 4;
+		compressed.resize(compressed.size() + padding, '\0');
+		header.size = uint32_t(sizeof(info) + compressed.size()) | ChunkCompressedBit;
+		to.write(reinterpret_cast< const char * >(&header), sizeof(header));
+		to.write(reinterpret_cast< const char * >(info), sizeof(info));
+		to.write(compressed.data(), compressed.size());
+		return;
+	}
+
 	to.write(reinterpret_cast< const char * >(&header), sizeof(header));
 	to.write(reinterpret_cast< const char * >(from.data()), from.size() * sizeof(T));
 }
+
+
+//helper function that writes a table of contents chunk ("ctoc") followed by some chunks
+// (as written by write_chunk), so readers can find any chunk by name (see MappedChunks.hpp):
+//Format of the table of contents chunk's data:
+// |ve|rs|io|n.| <-- four byte version (ChunkDirectoryVersion)
+// |co|un|t.|..| <-- four byte number of entries
+// |ma|gi|c.|..|of|fs|et|..|si|ze|..|..|cr|c3|2.|..| * count <-- one entry per chunk
+//  (offset is of the chunk's data from the start of the file; crc32 is of the chunk's data)
+enum : uint32_t { ChunkDirectoryVersion = 1 };
+
+inline void write_chunk_directory(std::string const &chunks, std::ostream *to_) {
+	assert(to_);
+	auto &to = *to_;
+
+	struct Entry {
+		char magic[4];
+		uint32_t offset;
+		uint32_t size;
+		uint32_t crc32;
+	};
+	static_assert(sizeof(Entry) == 16, "entry is packed");
+
+	//find the chunks:
+	std::vector< Entry > entries;
+	for (size_t at = 0; at < chunks.size(); ) {
+		if (chunks.size() - at < 8) throw std::runtime_error("Truncated chunk header");
+		Entry entry;
+		std::memcpy(entry.magic, chunks.data() + at, 4);
+		std::memcpy(&entry.size, chunks.data() + at + 4, 4);
+		entry.size &= ~ChunkCompressedBit; //(stored size; readers check the chunk header for compression)
+		if (chunks.size() - at - 8 < entry.size) throw std::runtime_error("Truncated chunk data");
+		entry.offset = uint32_t(at + 8); //(made relative to the file below)
+		entry.crc32 = uint32_t(::crc32(0L, reinterpret_cast< Bytef const * >(chunks.data() + at + 8), uInt(entry.size)));
+		entries.emplace_back(entry);
+		at += 8 + entry.size;
+	}
+
+	//chunks start right after the directory:
+	uint32_t directory_size = uint32_t(8 + 8 + entries.size() * sizeof(Entry));
+	for (auto &entry : entries) {
+		entry.offset += directory_size;
+	}
+
+	std::vector< char > data(8 + entries.size() * sizeof(Entry));
+	uint32_t version = ChunkDirectoryVersion;
+	uint32_t count = uint32_t(entries.size());
+	std::memcpy(&data[0], &version, 4);
+	std::memcpy(&data[4], &count, 4);
+	if (!entries.empty()) std::memcpy(&data[8], entries.data(), entries.size() * sizeof(Entry));
+	write_chunk("ctoc", data, &to);
+}
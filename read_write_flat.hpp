@@ -0,0 +1,291 @@
+#pragma once
+
+/*
+ * Flatten nested structures (structs holding vectors of structs holding vectors...) into
+ *  one contiguous, offset-indexed blob, and read them back -- or use them in place.
+ *
+ * A struct opts in by listing its fields in a static 'reflect' function:
+ *   struct Room {
+ *     bool locked;
+ *     std::vector< Object > objects;
+ *     template< typename R, typename V > static void reflect(R &room, V &&visit) {
+ *       visit(room.locked);
+ *       visit(room.objects);
+ *     }
+ *   };
+ * (visit(field, uint8_t()) stores an integer field as a smaller type; flatten() throws if it doesn't fit)
+ *
+ * Layout:
+ *  - every value has a fixed-size "record":
+ *     numbers (and bools, enums) are stored little-endian, at their own size (or the size asked for)
+ *     a reflected struct is the records of its fields, packed together
+ *     a std::vector is |u32 offset|u32 count|, pointing at the records of its elements
+ *  - the blob starts with the record of the value that was flattened; the elements of each
+ *    vector are stored contiguously (starting on a four-byte boundary) after that, in the
+ *    order the vectors are reached
+ * So a vector of numbers can be used in place (FlatArray::span()), and one element of a vector
+ *  of structs can be read without decoding the rest of it (FlatArray::load()).
+ *
+ * write_flat_chunk / read_flat_chunk store a blob as a chunk (see read_write_chunk.hpp).
+ */
+
+#include "read_write_chunk.hpp"
+#include "MappedChunks.hpp" //for ChunkSpan
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace flat {
+
+//visitor that does nothing (used to detect 'reflect'):
+struct Probe {
+	template< typename F > void operator()(F &) { }
+	template< typename F, typename S > void operator()(F &, S) { }
+};
+
+template< typename T, typename = void >
+struct is_reflected : std::false_type { };
+template< typename T >
+struct is_reflected< T, decltype(T::reflect(std::declval< T & >(), std::declval< Probe & >()), void()) > : std::true_type { };
+
+template< typename T >
+struct is_vector : std::false_type { };
+template< typename E, typename A >
+struct is_vector< std::vector< E, A > > : std::true_type { };
+
+template< typename T >
+struct is_number : std::integral_constant< bool, std::is_arithmetic< T >::value || std::is_enum< T >::value > { };
+
+//size of T's record:
+template< typename T >
+size_t record_size();
+
+struct SizeVisitor {
+	size_t *size;
+	template< typename F > void operator()(F const &) { *size += record_size< F >(); }
+	template< typename F, typename S > void operator()(F const &, S) { *size += sizeof(S); }
+};
+
+template< typename T >
+size_t record_size_of(std::true_type /*number*/, std::false_type) { return sizeof(T); }
+template< typename T >
+size_t record_size_of(std::false_type, std::true_type /*vector*/) { return 8; }
+template< typename T >
+size_t record_size_of(std::false_type, std::false_type) {
+	static_assert(is_reflected< T >::value, "flatten() handles numbers, std::vectors, and structs with a 'reflect' function");
+	static size_t const size = [](){
+		size_t size = 0;
+		T value = T();
+		T::reflect(value, SizeVisitor{ &size });
+		return size;
+	}();
+	return size;
+}
+template< typename T >
+size_t record_size() { return record_size_of< T >(is_number< T >(), is_vector< T >()); }
+
+//----- writing -----
+
+struct Writer {
+	std::vector< char > blob;
+
+	template< typename T >
+	void put_number(size_t at, T value) {
+		uint64_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(T)); //(fine for floats, too)
+		for (size_t i = 0; i < sizeof(T); i++) {
+			blob[at + i] = char((bits >> (8 * i)) & 0xff);
+		}
+	}
+
+	template< typename T >
+	void put(size_t at, T const &value) { put_dispatch(at, value, is_number< T >(), is_vector< T >()); }
+
+	//store 'value' as an S:
+	template< typename S, typename T >
+	void put_as(size_t at, T const &value) {
+		static_assert(std::is_integral< S >::value && (std::is_integral< T >::value || std::is_enum< T >::value), "only integers can be stored as other integers");
+		S stored = S(value);
+		if (T(stored) != value || (stored < S(0)) != (value < T(0))) {
+			throw std::runtime_error("Value " + std::to_string(int64_t(value)) + " doesn't fit in " + std::to_string(sizeof(S)) + " byte(s)");
+		}
+		put_number(at, stored);
+	}
+
+	template< typename T >
+	void put_dispatch(size_t at, T const &value, std::true_type /*number*/, std::false_type) {
+		put_number(at, value);
+	}
+
+	template< typename T >
+	void put_dispatch(size_t at, T const &value, std::false_type, std::true_type /*vector*/) {
+		typedef typename T::value_type E;
+		size_t stride = record_size< E >();
+		blob.resize((blob.size() + 3) & ~size_t(3), '\0');
+		size_t offset = blob.size();
+		if (offset > 0xffffffff || value.size() > 0xffffffff) throw std::runtime_error("Flattened data is too large");
+		blob.resize(offset + stride * value.size(), '\0');
+		put_number(at, uint32_t(offset));
+		put_number(at + 4, uint32_t(value.size()));
+		for (size_t i = 0; i < value.size(); i++) {
+			put(offset + stride * i, value[i]);
+		}
+	}
+
+	template< typename T >
+	void put_dispatch(size_t at, T const &value, std::false_type, std::false_type);
+};
+
+struct WriteVisitor {
+	Writer &writer;
+	size_t at;
+	template< typename F > void operator()(F const &field) {
+		writer.put(at, field);
+		at += record_size< F >();
+	}
+	template< typename F, typename S > void operator()(F const &field, S) {
+		writer.put_as< S >(at, field);
+		at += sizeof(S);
+	}
+};
+
+template< typename T >
+void Writer::put_dispatch(size_t at, T const &value, std::false_type, std::false_type) {
+	T::reflect(value, WriteVisitor{ *this, at });
+}
+
+//----- reading -----
+
+struct Reader {
+	char const *blob;
+	size_t size;
+
+	void check(size_t at, size_t count) const {
+		if (at > size || size - at < count) throw std::runtime_error("Flattened data is out of range");
+	}
+
+	template< typename T >
+	T get_number(size_t at) const {
+		check(at, sizeof(T));
+		uint64_t bits = 0;
+		for (size_t i = 0; i < sizeof(T); i++) {
+			bits |= uint64_t(uint8_t(blob[at + i])) << (8 * i);
+		}
+		T value;
+		std::memcpy(&value, &bits, sizeof(T));
+		return value;
+	}
+
+	template< typename T >
+	void get(size_t at, T *value) const { get_dispatch(at, value, is_number< T >(), is_vector< T >()); }
+
+	template< typename T >
+	void get_dispatch(size_t at, T *value, std::true_type /*number*/, std::false_type) const {
+		*value = get_number< T >(at);
+	}
+
+	template< typename T >
+	void get_dispatch(size_t at, T *value, std::false_type, std::true_type /*vector*/) const {
+		typedef typename T::value_type E;
+		size_t stride = record_size< E >();
+		uint32_t offset = get_number< uint32_t >(at);
+		uint32_t count = get_number< uint32_t >(at + 4);
+		if (stride != 0 && (offset > size || (size - offset) / stride < count)) throw std::runtime_error("Flattened data is out of range");
+		value->resize(count);
+		for (size_t i = 0; i < count; i++) {
+			get(offset + stride * i, &(*value)[i]);
+		}
+	}
+
+	template< typename T >
+	void get_dispatch(size_t at, T *value, std::false_type, std::false_type) const;
+};
+
+struct ReadVisitor {
+	Reader const &reader;
+	size_t at;
+	template< typename F > void operator()(F &field) {
+		reader.get(at, &field);
+		at += record_size< F >();
+	}
+	template< typename F, typename S > void operator()(F &field, S) {
+		field = F(reader.get_number< S >(at));
+		at += sizeof(S);
+	}
+};
+
+template< typename T >
+void Reader::get_dispatch(size_t at, T *value, std::false_type, std::false_type) const {
+	T::reflect(*value, ReadVisitor{ *this, at });
+}
+
+} //namespace flat
+
+//flatten 'value' into a blob:
+template< typename T >
+std::vector< char > flatten(T const &value) {
+	flat::Writer writer;
+	writer.blob.resize(flat::record_size< T >(), '\0');
+	writer.put(0, value);
+	return std::move(writer.blob);
+}
+
+//read back a value flattened by flatten():
+//NOTE: throws if the blob is out of range
+template< typename T >
+void unflatten(char const *data, size_t size, T *value) {
+	flat::Reader reader{ data, size };
+	reader.get(0, value);
+}
+
+//use a flattened std::vector< E > in place:
+template< typename E >
+struct FlatArray {
+	FlatArray() = default;
+	FlatArray(char const *data, size_t size) : reader{ data, size } {
+		offset = reader.get_number< uint32_t >(0);
+		count = reader.get_number< uint32_t >(4);
+		reader.check(offset, flat::record_size< E >() * count);
+	}
+
+	size_t size() const { return count; }
+
+	//decode just element 'i':
+	E load(size_t i) const {
+		if (i >= count) throw std::out_of_range("FlatArray index " + std::to_string(i) + " out of range (size " + std::to_string(count) + ")");
+		E value = E();
+		reader.get(offset + flat::record_size< E >() * i, &value);
+		return value;
+	}
+
+	//view the elements without decoding them (only for numbers, on little-endian machines):
+	ChunkSpan< E > span() const {
+		static_assert(flat::is_number< E >::value, "only arrays of numbers can be used directly");
+		uint16_t one = 1;
+		if (*reinterpret_cast< uint8_t const * >(&one) != 1) throw std::runtime_error("FlatArray::span() needs a little-endian machine");
+		if (reinterpret_cast< uintptr_t >(reader.blob + offset) % alignof(E) != 0) throw std::runtime_error("FlatArray is not aligned for its element type");
+		return ChunkSpan< E >(reinterpret_cast< E const * >(reader.blob + offset), count);
+	}
+
+	flat::Reader reader{ nullptr, 0 };
+	size_t offset = 0;
+	size_t count = 0;
+};
+
+//helper functions to store a flattened value as a chunk:
+template< typename T >
+void write_flat_chunk(std::string const &magic, T const &value, std::ostream *to, ChunkCodec codec = ChunkRaw) {
+	write_chunk(magic, flatten(value), to, codec);
+}
+
+template< typename T >
+void read_flat_chunk(std::istream &from, std::string const &magic, T *value) {
+	std::vector< char > blob;
+	read_chunk(from, magic, &blob);
+	unflatten(blob.data(), blob.size(), value);
+}